@@ -0,0 +1,552 @@
+#include "BroadPhaseRegionManager.h"
+
+using namespace physx;
+
+BroadPhaseRegionManager::Desc::Desc()
+	: nbSubdiv(4)
+	, upAxis(1)
+	, margin(0.1f)
+	, maxObjectsPerRegion(256)
+	, minObjectsPerRegion(32)
+	, maxDepth(3)
+	, maxChangesPerUpdate(4)
+	, updateInterval(30)
+	, defaultWorldBounds(PxVec3(-100.0f), PxVec3(100.0f))
+{
+}
+
+BroadPhaseRegionManager::BroadPhaseRegionManager()
+	: m_Scene(nullptr)
+	, m_NbRootNodes(0)
+	, m_NbActiveRegions(0)
+	, m_GridOrigin(0.0f)
+	, m_CellSize(0.0f)
+	, m_NbOutOfBoundsEvents(0)
+	, m_FrameCounter(0)
+{
+	m_WorldBounds.setEmpty();
+}
+
+BroadPhaseRegionManager::~BroadPhaseRegionManager()
+{
+	//     Ƿ ⼭   ʴ´. Release()  ȣ .
+}
+
+void BroadPhaseRegionManager::Init(PxScene& scene, const Desc& desc)
+{
+	PxBounds3 bounds = ComputeSceneBounds(scene);
+
+	if (bounds.isEmpty())
+	{
+		bounds = desc.defaultWorldBounds;
+	}
+
+	Init(scene, bounds, desc);
+}
+
+void BroadPhaseRegionManager::Init(PxScene& scene, const PxBounds3& worldBounds, const Desc& desc)
+{
+	PX_ASSERT(scene.getBroadPhaseType() == PxBroadPhaseType::eMBP);
+
+	Release();
+
+	m_Scene = &scene;
+	m_Desc = desc;
+
+	// Ʈ 迡 ɷ ٷ  ʵ  д.
+	m_WorldBounds = worldBounds;
+	m_WorldBounds.fattenFast(worldBounds.getExtents().maxElement() * desc.margin);
+
+	Build();
+}
+
+void BroadPhaseRegionManager::Release()
+{
+	if (m_Scene)
+	{
+		Clear();
+	}
+
+	m_Nodes.clear();
+	m_FreeBlocks.clear();
+	m_NbRootNodes = 0;
+	m_NbActiveRegions = 0;
+	m_OutOfBounds.clear();
+	m_Scene = nullptr;
+}
+
+void BroadPhaseRegionManager::OnObjectOutOfBounds(PxShape& shape, PxActor& actor)
+{
+	const PxRigidActor* rigid = actor.is<PxRigidActor>();
+
+	if (rigid)
+	{
+		m_OutOfBounds.push_back(PxShapeExt::getWorldBounds(shape, *rigid));
+	}
+
+	m_NbOutOfBoundsEvents++;
+}
+
+void BroadPhaseRegionManager::OnObjectOutOfBounds(PxAggregate& aggregate)
+{
+	PxActor* actors[64];
+	const PxU32 nbActors = aggregate.getNbActors();
+	PxBounds3 bounds = PxBounds3::empty();
+
+	for (PxU32 i = 0; i < nbActors; i += 64)
+	{
+		const PxU32 nbRead = aggregate.getActors(actors, 64, i);
+
+		for (PxU32 j = 0; j < nbRead; j++)
+		{
+			bounds.include(actors[j]->getWorldBounds());
+		}
+	}
+
+	if (!bounds.isEmpty())
+	{
+		m_OutOfBounds.push_back(bounds);
+	}
+
+	m_NbOutOfBoundsEvents++;
+}
+
+void BroadPhaseRegionManager::Update()
+{
+	if (!m_Scene)
+	{
+		return;
+	}
+
+	//    Ʈ   ڸ  Ѵ.
+	//   ڶ  ٿ带 Ű ڸ  .
+	if (!m_OutOfBounds.empty())
+	{
+		if (!CoverOutOfBounds())
+		{
+			PxBounds3 newBounds = m_WorldBounds;
+
+			for (auto& it : m_OutOfBounds)
+			{
+				newBounds.include(it);
+			}
+
+			newBounds.fattenFast(newBounds.getExtents().maxElement() * m_Desc.margin);
+			m_WorldBounds = newBounds;
+
+			Build();
+		}
+
+		m_OutOfBounds.clear();
+		return;
+	}
+
+	if (++m_FrameCounter < m_Desc.updateInterval)
+	{
+		return;
+	}
+
+	m_FrameCounter = 0;
+
+	RefreshCounts();
+
+	PxU32 nbChanges = 0;
+	const PxU32 nbNodes = PxU32(m_Nodes.size());
+
+	// ġ⸦  Ѵ.   ڽĵ Ʈ   𸣱 .
+	for (PxU32 i = 0; i < nbNodes && nbChanges < m_Desc.maxChangesPerUpdate; i++)
+	{
+		if (Merge(i))
+		{
+			nbChanges++;
+		}
+	}
+
+	for (PxU32 i = 0; i < nbNodes && nbChanges < m_Desc.maxChangesPerUpdate; i++)
+	{
+		if (Split(i))
+		{
+			nbChanges++;
+		}
+	}
+}
+
+void BroadPhaseRegionManager::OnOriginShift(const PxVec3& shift)
+{
+	//  ϵ  PxScene::shiftOrigin  Űش. ⼭   纻 .
+	m_WorldBounds.minimum -= shift;
+	m_WorldBounds.maximum -= shift;
+
+	m_GridOrigin -= shift;
+
+	for (auto& it : m_OutOfBounds)
+	{
+		it.minimum -= shift;
+		it.maximum -= shift;
+	}
+
+	for (auto& it : m_Nodes)
+	{
+		it.bounds.minimum -= shift;
+		it.bounds.maximum -= shift;
+	}
+}
+
+void BroadPhaseRegionManager::GetRegionBounds(std::vector<PxBounds3>& out) const
+{
+	out.clear();
+
+	for (auto& it : m_Nodes)
+	{
+		if (it.alive && it.handle != INVALID_INDEX)
+		{
+			out.push_back(it.bounds);
+		}
+	}
+}
+
+PxBounds3 BroadPhaseRegionManager::ComputeSceneBounds(PxScene& scene)
+{
+	PxBounds3 bounds = PxBounds3::empty();
+
+	const PxActorTypeFlags types = PxActorTypeFlag::eRIGID_DYNAMIC | PxActorTypeFlag::eRIGID_STATIC;
+	const PxU32 nbActors = scene.getNbActors(types);
+
+	std::vector<PxActor*> actors(nbActors);
+
+	if (nbActors)
+	{
+		scene.getActors(types, &actors[0], nbActors);
+	}
+
+	PxShape* shapes[16];
+
+	for (auto& it : actors)
+	{
+		const PxRigidActor* actor = it->is<PxRigidActor>();
+		const PxU32 nbShapes = actor->getNbShapes();
+
+		for (PxU32 i = 0; i < nbShapes; i += 16)
+		{
+			const PxU32 nbRead = actor->getShapes(shapes, 16, i);
+
+			for (PxU32 j = 0; j < nbRead; j++)
+			{
+				//   ٿ带 Ƿ .
+				if (shapes[j]->getGeometryType() != PxGeometryType::ePLANE)
+				{
+					bounds.include(PxShapeExt::getWorldBounds(*shapes[j], *actor));
+				}
+			}
+		}
+	}
+
+	return bounds;
+}
+
+//////////////////////////////////////////
+
+void BroadPhaseRegionManager::Build()
+{
+	//       Ʈ    ǹǷ
+	//  ڸ  ߰(populate)ϰ    .
+	std::vector<PxU32> oldHandles;
+
+	for (auto& it : m_Nodes)
+	{
+		if (it.alive && it.handle != INVALID_INDEX)
+		{
+			oldHandles.push_back(it.handle);
+		}
+	}
+
+	//   ִ 256    ִ.
+	PxU32 nbSubdiv = PxMax(m_Desc.nbSubdiv, 1u);
+	while (nbSubdiv > 1 && nbSubdiv * nbSubdiv + oldHandles.size() > 256)
+	{
+		nbSubdiv--;
+	}
+
+	m_Nodes.clear();
+	m_FreeBlocks.clear();
+	m_NbActiveRegions = 0;
+
+	PxBounds3 gridBounds[256];
+	m_NbRootNodes = PxBroadPhaseExt::createRegionsFromWorldBounds(gridBounds, m_WorldBounds, nbSubdiv, m_Desc.upAxis);
+
+	m_GridOrigin = m_WorldBounds.minimum;
+	m_CellSize = gridBounds[0].getDimensions();
+
+	const PxU32 first = AllocateNodes(m_NbRootNodes);
+
+	for (PxU32 i = 0; i < m_NbRootNodes; i++)
+	{
+		RegionNode& node = m_Nodes[first + i];
+		node.bounds = gridBounds[i];
+		node.depth = 0;
+
+		Activate(first + i, true);
+	}
+
+	for (auto& it : oldHandles)
+	{
+		m_Scene->removeBroadPhaseRegion(it);
+	}
+
+	m_FrameCounter = 0;
+}
+
+bool BroadPhaseRegionManager::CoverOutOfBounds()
+{
+	const PxU32 up = m_Desc.upAxis;
+	m_AddedBounds.clear();
+
+	for (auto& it : m_OutOfBounds)
+	{
+		//  ӿ      ǳʶڴ.
+		bool covered = false;
+
+		for (auto& added : m_AddedBounds)
+		{
+			if (it.isInside(added))
+			{
+				covered = true;
+				break;
+			}
+		}
+
+		if (covered)
+		{
+			continue;
+		}
+
+		if (m_NbActiveRegions >= 256)
+		{
+			return false;
+		}
+
+		// ó  ĭ 缭 ٿ带  ĭ   .    ̱ ´.
+		PxBounds3 bounds;
+
+		for (PxU32 axis = 0; axis < 3; axis++)
+		{
+			if (axis == up)
+			{
+				bounds.minimum[axis] = PxMin(m_WorldBounds.minimum[axis], it.minimum[axis]);
+				bounds.maximum[axis] = PxMax(m_WorldBounds.maximum[axis], it.maximum[axis]);
+				continue;
+			}
+
+			const PxReal origin = m_GridOrigin[axis];
+			const PxReal size = m_CellSize[axis];
+			bounds.minimum[axis] = origin + PxFloor((it.minimum[axis] - origin) / size) * size;
+			bounds.maximum[axis] = origin + (PxFloor((it.maximum[axis] - origin) / size) + 1.0f) * size;
+		}
+
+		const PxU32 nodeIndex = AllocateNodes(1);
+		m_Nodes[nodeIndex].bounds = bounds;
+
+		if (!Activate(nodeIndex, true))
+		{
+			m_Nodes[nodeIndex].alive = false;
+			return false;
+		}
+
+		m_NbRootNodes++;
+		m_WorldBounds.include(bounds);
+		m_AddedBounds.push_back(bounds);
+	}
+
+	return true;
+}
+
+void BroadPhaseRegionManager::Clear()
+{
+	for (auto& it : m_Nodes)
+	{
+		if (it.alive && it.handle != INVALID_INDEX)
+		{
+			m_Scene->removeBroadPhaseRegion(it.handle);
+			it.handle = INVALID_INDEX;
+		}
+	}
+
+	m_NbActiveRegions = 0;
+}
+
+void BroadPhaseRegionManager::RefreshCounts()
+{
+	const PxU32 nbRegions = m_Scene->getNbBroadPhaseRegions();
+
+	m_InfoBuffer.resize(nbRegions);
+
+	if (!nbRegions)
+	{
+		return;
+	}
+
+	const PxU32 nbRead = m_Scene->getBroadPhaseRegions(&m_InfoBuffer[0], nbRegions);
+
+	//  userData   ε + 1  ־ξ.
+	for (PxU32 i = 0; i < nbRead; i++)
+	{
+		const PxBroadPhaseRegionInfo& info = m_InfoBuffer[i];
+
+		if (!info.active)
+		{
+			continue;
+		}
+
+		const PxU32 nodeIndex = PxU32(reinterpret_cast<size_t>(info.region.userData)) - 1;
+
+		if (nodeIndex < m_Nodes.size())
+		{
+			m_Nodes[nodeIndex].nbObjects = info.nbStaticObjects + info.nbDynamicObjects;
+		}
+	}
+}
+
+bool BroadPhaseRegionManager::Split(PxU32 nodeIndex)
+{
+	RegionNode& node = m_Nodes[nodeIndex];
+
+	if (!node.alive || node.handle == INVALID_INDEX
+		|| node.nbObjects <= m_Desc.maxObjectsPerRegion
+		|| node.depth >= m_Desc.maxDepth
+		|| m_NbActiveRegions + 3 > 256)
+	{
+		return false;
+	}
+
+	PxBounds3 childBounds[4];
+	PxBroadPhaseExt::createRegionsFromWorldBounds(childBounds, node.bounds, 2, m_Desc.upAxis);
+
+	// AllocateNodes  m_Nodes  Ű  Ƿ node  Ŀ  ʴ´.
+	const PxU32 depth = node.depth;
+	const PxU32 objectsPerChild = node.nbObjects / 4;
+	const PxU32 firstChild = AllocateNodes(4);
+
+	for (PxU32 i = 0; i < 4; i++)
+	{
+		RegionNode& child = m_Nodes[firstChild + i];
+		child.bounds = childBounds[i];
+		child.parent = nodeIndex;
+		child.depth = depth + 1;
+		child.nbObjects = objectsPerChild;
+
+		Activate(firstChild + i, true);
+	}
+
+	m_Nodes[nodeIndex].firstChild = firstChild;
+	Deactivate(nodeIndex);
+
+	return true;
+}
+
+bool BroadPhaseRegionManager::Merge(PxU32 nodeIndex)
+{
+	RegionNode& node = m_Nodes[nodeIndex];
+
+	if (!node.alive || node.firstChild == INVALID_INDEX)
+	{
+		return false;
+	}
+
+	PxU32 nbObjects = 0;
+
+	for (PxU32 i = 0; i < 4; i++)
+	{
+		const RegionNode& child = m_Nodes[node.firstChild + i];
+
+		// ڰ ִ ڽ   Ѵ.
+		if (child.handle == INVALID_INDEX)
+		{
+			return false;
+		}
+
+		nbObjects += child.nbObjects;
+	}
+
+	if (nbObjects >= m_Desc.minObjectsPerRegion)
+	{
+		return false;
+	}
+
+	const PxU32 firstChild = node.firstChild;
+
+	node.nbObjects = nbObjects;
+	node.firstChild = INVALID_INDEX;
+	Activate(nodeIndex, true);
+
+	for (PxU32 i = 0; i < 4; i++)
+	{
+		Deactivate(firstChild + i);
+		m_Nodes[firstChild + i].alive = false;
+	}
+
+	m_FreeBlocks.push_back(firstChild);
+
+	return true;
+}
+
+PxU32 BroadPhaseRegionManager::AllocateNodes(PxU32 count)
+{
+	PxU32 first;
+
+	if (count == 4 && !m_FreeBlocks.empty())
+	{
+		first = m_FreeBlocks.back();
+		m_FreeBlocks.pop_back();
+	}
+	else
+	{
+		first = PxU32(m_Nodes.size());
+		m_Nodes.resize(m_Nodes.size() + count);
+	}
+
+	for (PxU32 i = 0; i < count; i++)
+	{
+		RegionNode& node = m_Nodes[first + i];
+		node.bounds.setEmpty();
+		node.handle = INVALID_INDEX;
+		node.parent = INVALID_INDEX;
+		node.firstChild = INVALID_INDEX;
+		node.depth = 0;
+		node.nbObjects = 0;
+		node.alive = true;
+	}
+
+	return first;
+}
+
+bool BroadPhaseRegionManager::Activate(PxU32 nodeIndex, bool populate)
+{
+	RegionNode& node = m_Nodes[nodeIndex];
+
+	PxBroadPhaseRegion region;
+	region.bounds = node.bounds;
+	region.userData = reinterpret_cast<void*>(size_t(nodeIndex) + 1);
+
+	// populate  true  ̹  ִ Ʈ鵵   ־ش. ( )
+	node.handle = m_Scene->addBroadPhaseRegion(region, populate);
+
+	if (node.handle == INVALID_INDEX)
+	{
+		return false;
+	}
+
+	m_NbActiveRegions++;
+	return true;
+}
+
+void BroadPhaseRegionManager::Deactivate(PxU32 nodeIndex)
+{
+	RegionNode& node = m_Nodes[nodeIndex];
+
+	if (node.handle != INVALID_INDEX)
+	{
+		m_Scene->removeBroadPhaseRegion(node.handle);
+		node.handle = INVALID_INDEX;
+		m_NbActiveRegions--;
+	}
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+
+#include "OriginShiftManager.h"
+
+/*
+	MBP ε (region) .
+
+	 ִ ͵   ٿκ PxBroadPhaseExt::createRegionsFromWorldBounds ڸ ,
+	 Ʈ  ֱ Ȯؼ  Ʈ · ų(split) ģ(merge).
+
+	- Ʈ ʹ   4 .
+	-   4  ѻ θ  ϳ ģ.
+	-    Ʈ Ǹ  ڸ   ĭ ֻ  Ѵ.
+	    (256) ɸ  ٿ带 Ű ڸ ٽ .
+
+	 ߰/Ŵ ùķ̼ ߿   Ƿ Update() fetchResults Ŀ ȣѴ.
+*/
+
+class BroadPhaseRegionManager : public OriginShiftListener
+{
+public:
+	struct Desc
+	{
+		physx::PxU32	nbSubdiv;				// ʱ    (nbSubdiv * nbSubdiv  )
+		physx::PxU32	upAxis;					// 0 : X, 1 : Y, 2 : Z
+		physx::PxReal	margin;					//  ٿ忡   
+		physx::PxU32	maxObjectsPerRegion;	// ̺  .
+		physx::PxU32	minObjectsPerRegion;	//  հ谡 ̺  ģ.
+		physx::PxU32	maxDepth;				// ʱ ڷκ   ִ ִ ܰ
+		physx::PxU32	maxChangesPerUpdate;	//   Update ų ĥ ִ Ƚ
+		physx::PxU32	updateInterval;			//  Ӹ е Ȯ
+		physx::PxBounds3 defaultWorldBounds;	//     ٿ
+
+		Desc();
+	};
+
+	BroadPhaseRegionManager();
+	virtual ~BroadPhaseRegionManager();
+
+	//  ִ ͵ ٿ  ٿ带 ؼ  .
+	void Init(physx::PxScene& scene, const Desc& desc = Desc());
+	void Init(physx::PxScene& scene, const physx::PxBounds3& worldBounds, const Desc& desc = Desc());
+	void Release();
+
+	// PxBroadPhaseCallback  ȣѴ.
+	void OnObjectOutOfBounds(physx::PxShape& shape, physx::PxActor& actor);
+	void OnObjectOutOfBounds(physx::PxAggregate& aggregate);
+
+	// fetchResults    ȣ.
+	void Update();
+
+	// PxScene::shiftOrigin    ȣؼ ڰ ִ ٿ带 .
+	// OriginShiftManager  ʷ ϸ ڵ ȣȴ.
+	virtual void OnOriginShift(const physx::PxVec3& shift) override;
+
+	physx::PxU32			GetNbRegions() const { return m_NbActiveRegions; }
+	physx::PxU32			GetNbOutOfBoundsEvents() const { return m_NbOutOfBoundsEvents; }
+	const physx::PxBounds3&	GetWorldBounds() const { return m_WorldBounds; }
+	void					GetRegionBounds(std::vector<physx::PxBounds3>& out) const;
+
+	static physx::PxBounds3 ComputeSceneBounds(physx::PxScene& scene);
+
+private:
+	static const physx::PxU32 INVALID_INDEX = 0xffffffff;
+
+	struct RegionNode
+	{
+		physx::PxBounds3	bounds;
+		physx::PxU32		handle;			//  ϵ  ڵ. Ȱ  ƴϸ INVALID_INDEX
+		physx::PxU32		parent;
+		physx::PxU32		firstChild;		// ڽ 4  Ҵȴ.  INVALID_INDEX
+		physx::PxU32		depth;
+		physx::PxU32		nbObjects;		//  Ȯ Ʈ 
+		bool				alive;
+	};
+
+	void	Build();
+	bool	CoverOutOfBounds();
+	void	Clear();
+	void	RefreshCounts();
+	bool	Split(physx::PxU32 nodeIndex);
+	bool	Merge(physx::PxU32 nodeIndex);
+
+	physx::PxU32	AllocateNodes(physx::PxU32 count);
+	bool			Activate(physx::PxU32 nodeIndex, bool populate);
+	void			Deactivate(physx::PxU32 nodeIndex);
+
+private:
+	physx::PxScene*		m_Scene;
+	Desc				m_Desc;
+	physx::PxBounds3	m_WorldBounds;
+
+	std::vector<RegionNode>		m_Nodes;
+	std::vector<physx::PxU32>	m_FreeBlocks;	// 鼭 Ե ڽ 4   ε
+	physx::PxU32				m_NbRootNodes;
+	physx::PxU32				m_NbActiveRegions;
+
+	std::vector<physx::PxBroadPhaseRegionInfo> m_InfoBuffer;
+
+	physx::PxVec3		m_GridOrigin;			// ó  ּ 𼭸.  ֻ    ĭ .
+	physx::PxVec3		m_CellSize;
+
+	std::vector<physx::PxBounds3>	m_OutOfBounds;	// ̹ ӿ    Ʈ ٿ
+	std::vector<physx::PxBounds3>	m_AddedBounds;
+	physx::PxU32		m_NbOutOfBoundsEvents;	// 
+	physx::PxU32		m_FrameCounter;
+};
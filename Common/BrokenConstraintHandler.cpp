@@ -0,0 +1,106 @@
+#include "BrokenConstraintHandler.h"
+
+using namespace physx;
+
+BrokenConstraintHandler::BrokenConstraintHandler()
+	: m_DefaultPolicy(BrokenConstraintPolicy::eRELEASE)
+	, m_RecycleFunction(nullptr)
+	, m_RecycleUserData(nullptr)
+	, m_NbProcessed(0)
+	, m_NbDuplicates(0)
+	, m_NbPendingDuplicates(0)
+	, m_TotalProcessed(0)
+	, m_HistoryIndex(0)
+{
+	for (auto& it : m_History)
+	{
+		it = 0;
+	}
+}
+
+BrokenConstraintPolicy BrokenConstraintHandler::GetPolicy(PxU32 type) const
+{
+	auto it = m_Policies.find(type);
+	return it != m_Policies.end() ? it->second : m_DefaultPolicy;
+}
+
+PxU32 BrokenConstraintHandler::GetNbProcessed(PxU32 type) const
+{
+	auto it = m_NbProcessedByType.find(type);
+	return it != m_NbProcessedByType.end() ? it->second : 0;
+}
+
+bool BrokenConstraintHandler::Add(PxConstraint& constraint)
+{
+	PxU32 type;
+	void* externalReference = constraint.getExternalReference(type);
+
+	if (GetPolicy(type) == BrokenConstraintPolicy::eKEEP && !(constraint.getFlags() & PxConstraintFlag::eBROKEN))
+	{
+		return false;
+	}
+
+	Push(PxConstraintInfo(&constraint, externalReference, type));
+	return true;
+}
+
+void BrokenConstraintHandler::onConstraintBreak(PxConstraintInfo* constraints, PxU32 count)
+{
+	// ⼭   . Ƶα⸸ Ѵ.
+	for (PxU32 i = 0; i < count; i++)
+	{
+		Push(constraints[i]);
+	}
+}
+
+void BrokenConstraintHandler::Push(const PxConstraintInfo& info)
+{
+	if (m_PendingSet.insert(info.constraint).second)
+	{
+		m_Pending.push_back(info);
+	}
+	else
+	{
+		m_NbPendingDuplicates++;
+	}
+}
+
+void BrokenConstraintHandler::Process()
+{
+	m_NbProcessedByType.clear();
+
+	for (const PxConstraintInfo& info : m_Pending)
+	{
+		m_NbProcessedByType[info.type]++;
+
+		switch (GetPolicy(info.type))
+		{
+		case BrokenConstraintPolicy::eKEEP:
+			break;
+
+		case BrokenConstraintPolicy::eRECYCLE:
+			if (m_RecycleFunction)
+			{
+				(*m_RecycleFunction)(info, m_RecycleUserData);
+			}
+			info.constraint->release();
+			break;
+
+		case BrokenConstraintPolicy::eRELEASE:
+			//  ڷδ info.externalReference  Ű Ʈ Ǿ .
+			info.constraint->release();
+			break;
+		}
+	}
+
+	m_NbProcessed = PxU32(m_Pending.size());
+	m_NbDuplicates = m_NbPendingDuplicates;
+	m_TotalProcessed += m_NbProcessed;
+
+	m_History[m_HistoryIndex] = m_NbProcessed;
+	m_HistoryIndex = (m_HistoryIndex + 1) % HISTORY_SIZE;
+
+	m_Pending.clear();
+	m_PendingSet.clear();
+	m_NbPendingDuplicates = 0;
+}
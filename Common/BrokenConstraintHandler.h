@@ -0,0 +1,102 @@
+#pragma once
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+
+/*
+	  ó.
+
+	onConstraintBreak ȿ SDK ü   Ƿ PxConstraintInfo  Ƶΰ,
+	fetchResults  Process() ŸԺ  å    óѴ.
+	flushSimulation ̳  å(Add)       ־ ؽü ߺ Ÿ.
+
+	Ÿ PxConstraintInfo::type ̴. PhysX Ȯ Ʈ  PxConstraintExtIDs::eJOINT  ,
+	 Ʈ getExternalReference  ִ (PulleyJoint::TYPE_ID ) ´.
+
+	PxConstraintFlag::eBROKEN  б ̶  Ʈ ٽ   .
+	eRECYCLE   Լ  ڸ  Ʈ      Ѵ.
+
+	
+		sceneDesc.simulationEventCallback = &handler;
+		handler.SetPolicy(PxConstraintExtIDs::eJOINT, BrokenConstraintPolicy::eRELEASE);
+		fetchResults 	: handler.Process();
+						  handler.GetNbProcessed() ...
+*/
+
+enum class BrokenConstraintPolicy
+{
+	eKEEP,		// ״ д.  .
+	eRELEASE,	// Ѵ.
+	eRECYCLE,	// Ȱ Լ θ  Ѵ.
+};
+
+class BrokenConstraintHandler : public physx::PxSimulationEventCallback
+{
+public:
+	static const physx::PxU32 HISTORY_SIZE = 120;
+
+	//  Ʈ Ϳ    Ʈ .  Ʈ ȣ  ȴ.
+	typedef void (*RecycleFunction)(const physx::PxConstraintInfo& info, void* userData);
+
+	BrokenConstraintHandler();
+	virtual ~BrokenConstraintHandler() = default;
+
+	void SetPolicy(physx::PxU32 type, BrokenConstraintPolicy policy) { m_Policies[type] = policy; }
+	BrokenConstraintPolicy GetPolicy(physx::PxU32 type) const;
+
+	// Ÿ ϵ ʾ   å. ⺻ eRELEASE.
+	void SetDefaultPolicy(BrokenConstraintPolicy policy) { m_DefaultPolicy = policy; }
+
+	void SetRecycleFunction(RecycleFunction function, void* userData) { m_RecycleFunction = function; m_RecycleUserData = userData; }
+
+	// SDK    ൵   óϰ ִ´. (ڷƮ å )
+	//    Ÿ å eKEEP ̸   Ƿ  ʰ false  ش.
+	bool Add(physx::PxConstraint& constraint);
+
+	// fetchResults  ȣ. Ƶ  å óѴ.
+	void Process();
+
+	//  Process  ó  ɷ ߺ .
+	physx::PxU32	GetNbProcessed() const { return m_NbProcessed; }
+	physx::PxU32	GetNbProcessed(physx::PxU32 type) const;
+	physx::PxU32	GetNbDuplicates() const { return m_NbDuplicates; }
+	physx::PxU64	GetTotalProcessed() const { return m_TotalProcessed; }
+
+	// ֱ HISTORY_SIZE  ó . GetHistoryStart()    ĭ̴.
+	const physx::PxU32*	GetHistory() const { return m_History; }
+	physx::PxU32		GetHistoryStart() const { return m_HistoryIndex; }
+
+public: // PxSimulationEventCallback
+	virtual void onConstraintBreak(physx::PxConstraintInfo* constraints, physx::PxU32 count) override;
+	virtual void onWake(physx::PxActor**, physx::PxU32) override {}
+	virtual void onSleep(physx::PxActor**, physx::PxU32) override {}
+	virtual void onContact(const physx::PxContactPairHeader&, const physx::PxContactPair*, physx::PxU32) override {}
+	virtual void onTrigger(physx::PxTriggerPair*, physx::PxU32) override {}
+	virtual void onAdvance(const physx::PxRigidBody* const*, const physx::PxTransform*, const physx::PxU32) override {}
+
+private:
+	void Push(const physx::PxConstraintInfo& info);
+
+private:
+	std::unordered_map<physx::PxU32, BrokenConstraintPolicy>	m_Policies;
+	BrokenConstraintPolicy										m_DefaultPolicy;
+
+	RecycleFunction	m_RecycleFunction;
+	void*			m_RecycleUserData;
+
+	std::unordered_set<physx::PxConstraint*>	m_PendingSet;	// ߺ ˻
+	std::vector<physx::PxConstraintInfo>		m_Pending;		//   
+
+	std::unordered_map<physx::PxU32, physx::PxU32>	m_NbProcessedByType;
+
+	physx::PxU32	m_NbProcessed;
+	physx::PxU32	m_NbDuplicates;
+	physx::PxU32	m_NbPendingDuplicates;
+	physx::PxU64	m_TotalProcessed;
+
+	physx::PxU32	m_History[HISTORY_SIZE];
+	physx::PxU32	m_HistoryIndex;
+};
@@ -0,0 +1,207 @@
+#include "ConstraintTelemetry.h"
+
+using namespace physx;
+
+void ConstraintTelemetry::EndTask::release()
+{
+	PxLightCpuTask::release();
+	SnippetUtils::syncSet(m_Telemetry->m_EndSync);
+}
+
+ConstraintTelemetry::ConstraintTelemetry()
+	: m_TaskManager(nullptr)
+	, m_EndSync(nullptr)
+	, m_MaxStress(0.0f)
+	, m_GatherMs(0.0f)
+{
+	m_EndTask.m_Telemetry = this;
+}
+
+ConstraintTelemetry::~ConstraintTelemetry()
+{
+	Release();
+}
+
+void ConstraintTelemetry::Init(PxCpuDispatcher& dispatcher)
+{
+	Release();
+
+	m_TaskManager = PxTaskManager::createTaskManager(PxGetFoundation().getErrorCallback(), &dispatcher);
+	m_EndSync = SnippetUtils::syncCreate();
+}
+
+void ConstraintTelemetry::Release()
+{
+	Clear();
+	m_GatherTasks.clear();
+
+	if (m_EndSync)
+	{
+		SnippetUtils::syncRelease(m_EndSync);
+		m_EndSync = nullptr;
+	}
+
+	PX_RELEASE(m_TaskManager);
+}
+
+PxU32 ConstraintTelemetry::Add(PxConstraint& constraint, PxReal linearLimit, PxReal angularLimit, void* userData)
+{
+	m_Constraints.push_back(&constraint);
+	m_UserData.push_back(userData);
+	m_LinearLimit.push_back(linearLimit);
+	m_AngularLimit.push_back(angularLimit);
+
+	m_Linear.PushBack(PxVec3(0.0f));
+	m_Angular.PushBack(PxVec3(0.0f));
+	m_Stress.push_back(0.0f);
+	m_OverloadFrames.push_back(0);
+
+	return PxU32(m_Constraints.size() - 1);
+}
+
+void ConstraintTelemetry::Remove(PxU32 index)
+{
+	const PxU32 last = PxU32(m_Constraints.size() - 1);
+
+	if (index != last)
+	{
+		m_Constraints[index] = m_Constraints[last];
+		m_UserData[index] = m_UserData[last];
+		m_LinearLimit[index] = m_LinearLimit[last];
+		m_AngularLimit[index] = m_AngularLimit[last];
+		m_Linear.Set(index, m_Linear.Get(last));
+		m_Angular.Set(index, m_Angular.Get(last));
+		m_Stress[index] = m_Stress[last];
+		m_OverloadFrames[index] = m_OverloadFrames[last];
+	}
+
+	m_Constraints.pop_back();
+	m_UserData.pop_back();
+	m_LinearLimit.pop_back();
+	m_AngularLimit.pop_back();
+	m_Linear.PopBack();
+	m_Angular.PopBack();
+	m_Stress.pop_back();
+	m_OverloadFrames.pop_back();
+
+	//  Gather   ε ٲǷ .
+	m_Overloaded.clear();
+	m_Broken.clear();
+}
+
+void ConstraintTelemetry::Clear()
+{
+	m_Constraints.clear();
+	m_UserData.clear();
+	m_LinearLimit.clear();
+	m_AngularLimit.clear();
+	m_Linear.Clear();
+	m_Angular.Clear();
+	m_Stress.clear();
+	m_OverloadFrames.clear();
+	m_Overloaded.clear();
+	m_Broken.clear();
+	m_MaxStress = 0.0f;
+}
+
+void ConstraintTelemetry::SetLimits(PxU32 index, PxReal linearLimit, PxReal angularLimit)
+{
+	m_LinearLimit[index] = linearLimit;
+	m_AngularLimit[index] = angularLimit;
+}
+
+void ConstraintTelemetry::Gather(bool parallel)
+{
+	const PxU64 start = SnippetUtils::getCurrentTimeCounterValue();
+
+	const PxU32 nbChunks = (GetNbConstraints() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+	m_Chunks.resize(nbChunks);
+
+	if (parallel && m_TaskManager && nbChunks > 1)
+	{
+		if (m_GatherTasks.size() < nbChunks)
+		{
+			m_GatherTasks.resize(nbChunks);
+		}
+
+		SnippetUtils::syncReset(m_EndSync);
+		m_EndTask.setContinuation(*m_TaskManager, nullptr);
+
+		for (PxU32 i = 0; i < nbChunks; i++)
+		{
+			GatherTask& task = m_GatherTasks[i];
+			task.m_Telemetry = this;
+			task.m_Chunk = i;
+			task.setContinuation(*m_TaskManager, &m_EndTask);
+			task.removeReference();
+		}
+
+		m_EndTask.removeReference();
+		SnippetUtils::syncWait(m_EndSync);
+	}
+	else
+	{
+		for (PxU32 i = 0; i < nbChunks; i++)
+		{
+			GatherChunk(i);
+		}
+	}
+
+	// ûũ    ȴ.
+	m_Overloaded.clear();
+	m_Broken.clear();
+	m_MaxStress = 0.0f;
+
+	for (const Chunk& chunk : m_Chunks)
+	{
+		m_Overloaded.insert(m_Overloaded.end(), chunk.overloaded.begin(), chunk.overloaded.end());
+		m_Broken.insert(m_Broken.end(), chunk.broken.begin(), chunk.broken.end());
+		m_MaxStress = PxMax(m_MaxStress, chunk.maxStress);
+	}
+
+	m_GatherMs = SnippetUtils::getElapsedTimeInMilliseconds(SnippetUtils::getCurrentTimeCounterValue() - start);
+}
+
+void ConstraintTelemetry::GatherChunk(PxU32 chunkIndex)
+{
+	Chunk& chunk = m_Chunks[chunkIndex];
+	chunk.overloaded.clear();
+	chunk.broken.clear();
+	chunk.maxStress = 0.0f;
+
+	const PxU32 begin = chunkIndex * CHUNK_SIZE;
+	const PxU32 end = PxMin(begin + CHUNK_SIZE, GetNbConstraints());
+
+	for (PxU32 i = begin; i < end; i++)
+	{
+		PxVec3 linear(0.0f), angular(0.0f);
+
+		//     ʴ´.
+		if (m_Constraints[i]->getFlags() & PxConstraintFlag::eBROKEN)
+		{
+			chunk.broken.push_back(i);
+		}
+		else
+		{
+			m_Constraints[i]->getForce(linear, angular);
+		}
+
+		m_Linear.Set(i, linear);
+		m_Angular.Set(i, angular);
+
+		const PxReal stress = PxMax(linear.magnitude() / m_LinearLimit[i], angular.magnitude() / m_AngularLimit[i]);
+		m_Stress[i] = stress;
+
+		if (stress > 1.0f)
+		{
+			m_OverloadFrames[i]++;
+			chunk.overloaded.push_back(i);
+		}
+		else
+		{
+			m_OverloadFrames[i] = 0;
+		}
+
+		chunk.maxStress = PxMax(chunk.maxStress, stress);
+	}
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+
+#include "SnippetUtils.h"
+
+/*
+	  PxConstraint  getForce()  fetchResults ڿ   о SoA 迭 Ƶδ ڷƮ.
+
+	ึ  /  Ѱ踦 ָ stress = max(|| /  Ѱ, || /  Ѱ)   Ѵ.
+	stress  1    GetOverloaded()  ̰,  ѱ Ƚ GetOverloadFrames()    ִ.
+	SDK  breakForce  "    ´"   å̳  Ʈʿ .
+
+	Init  ó ָ CHUNK_SIZE   ½ũ а,   ٸ.
+	getForce  б  ȣ̹Ƿ simulate  ƴϸ  忡  ҷ ȴ.
+	Solver    Px1DConstraintFlag::eOUTPUT_FORCE   ־ Ѵ. (Ȯ Ʈ PulleyJoint   ִ.)
+
+	    ʰ GetBroken()  ø. ϱ  Remove ؾ Ѵ.
+
+	Remove   Ҹ ڸ űǷ,     ū ε .
+
+	
+		telemetry.Init(*dispatcher);
+		telemetry.Add(*joint->getConstraint(), 1000.0f, 10000.0f, joint);
+		fetchResults 	: telemetry.Gather();
+						  for (i : telemetry.GetOverloaded()) ... telemetry.GetStress(i) ...
+*/
+
+class ConstraintTelemetry
+{
+public:
+	static const physx::PxU32 CHUNK_SIZE = 1024;
+
+public:
+	ConstraintTelemetry();
+	~ConstraintTelemetry();
+
+	// ó   Gather  ȣ 忡  д´.
+	void Init(physx::PxCpuDispatcher& dispatcher);
+	void Release();
+
+	// ε ش.
+	physx::PxU32 Add(physx::PxConstraint& constraint, physx::PxReal linearLimit = PX_MAX_F32, physx::PxReal angularLimit = PX_MAX_F32, void* userData = nullptr);
+	void Remove(physx::PxU32 index);
+	void Clear();
+
+	void SetLimits(physx::PxU32 index, physx::PxReal linearLimit, physx::PxReal angularLimit);
+
+	// fetchResults   忡 ȣ.
+	void Gather(bool parallel = true);
+
+	physx::PxU32			GetNbConstraints() const { return physx::PxU32(m_Constraints.size()); }
+	physx::PxConstraint*	GetConstraint(physx::PxU32 index) const { return m_Constraints[index]; }
+	void*					GetUserData(physx::PxU32 index) const { return m_UserData[index]; }
+
+	physx::PxVec3	GetLinearForce(physx::PxU32 index) const { return m_Linear.Get(index); }
+	physx::PxVec3	GetAngularForce(physx::PxU32 index) const { return m_Angular.Get(index); }
+	physx::PxReal	GetStress(physx::PxU32 index) const { return m_Stress[index]; }
+	physx::PxU32	GetOverloadFrames(physx::PxU32 index) const { return m_OverloadFrames[index]; }
+
+	// SoA  ״ ѱ. Ʈó    .
+	const physx::PxReal*	GetStressColumn() const { return m_Stress.data(); }
+
+	// .
+	const std::vector<physx::PxU32>&	GetOverloaded() const { return m_Overloaded; }
+	const std::vector<physx::PxU32>&	GetBroken() const { return m_Broken; }
+	physx::PxReal						GetMaxStress() const { return m_MaxStress; }
+	physx::PxReal						GetLastGatherMilliseconds() const { return m_GatherMs; }
+
+private:
+	struct Vec3Column
+	{
+		std::vector<physx::PxReal> x, y, z;
+
+		void PushBack(const physx::PxVec3& v) { x.push_back(v.x); y.push_back(v.y); z.push_back(v.z); }
+		void PopBack() { x.pop_back(); y.pop_back(); z.pop_back(); }
+		void Clear() { x.clear(); y.clear(); z.clear(); }
+		void Set(physx::PxU32 i, const physx::PxVec3& v) { x[i] = v.x; y[i] = v.y; z[i] = v.z; }
+		physx::PxVec3 Get(physx::PxU32 i) const { return physx::PxVec3(x[i], y[i], z[i]); }
+	};
+
+	struct Chunk
+	{
+		std::vector<physx::PxU32>	overloaded;
+		std::vector<physx::PxU32>	broken;
+		physx::PxReal				maxStress;
+	};
+
+	class GatherTask : public physx::PxLightCpuTask
+	{
+	public:
+		virtual void		run() override { m_Telemetry->GatherChunk(m_Chunk); }
+		virtual const char*	getName() const override { return "ConstraintTelemetry::GatherTask"; }
+
+		ConstraintTelemetry*	m_Telemetry;
+		physx::PxU32			m_Chunk;
+	};
+
+	class EndTask : public physx::PxLightCpuTask
+	{
+	public:
+		virtual void		run() override {}
+		virtual void		release() override;
+		virtual const char*	getName() const override { return "ConstraintTelemetry::EndTask"; }
+
+		ConstraintTelemetry*	m_Telemetry;
+	};
+
+	void GatherChunk(physx::PxU32 chunk);
+
+private:
+	physx::PxTaskManager*		m_TaskManager;
+	std::vector<GatherTask>		m_GatherTasks;
+	EndTask						m_EndTask;
+	physx::SnippetUtils::Sync*	m_EndSync;
+
+	std::vector<physx::PxConstraint*>	m_Constraints;
+	std::vector<void*>					m_UserData;
+	std::vector<physx::PxReal>			m_LinearLimit;
+	std::vector<physx::PxReal>			m_AngularLimit;
+
+	// Gather  ä .
+	Vec3Column							m_Linear;
+	Vec3Column							m_Angular;
+	std::vector<physx::PxReal>			m_Stress;
+	std::vector<physx::PxU32>			m_OverloadFrames;
+
+	std::vector<Chunk>					m_Chunks;
+	std::vector<physx::PxU32>			m_Overloaded;
+	std::vector<physx::PxU32>			m_Broken;
+	physx::PxReal						m_MaxStress;
+	physx::PxReal						m_GatherMs;
+};
@@ -0,0 +1,186 @@
+#include "ContactAggregator.h"
+
+using namespace physx;
+
+PxU32 ContactAggregator::Hash(const PxRigidActor* actor0, const PxRigidActor* actor1)
+{
+	PxU64 key = PxU64(size_t(actor0)) * 0x9E3779B97F4A7C15ull ^ PxU64(size_t(actor1));
+	key ^= key >> 29;
+	key *= 0xBF58476D1CE4E5B9ull;
+	key ^= key >> 32;
+	return PxU32(key);
+}
+
+ContactAggregator::Entry& ContactAggregator::Table::Insert(const PxRigidActor* actor0, const PxRigidActor* actor1)
+{
+	//  1/2 Ʒ Ѵ.
+	if ((entries.size() + 1) * 2 > slots.size())
+	{
+		Rehash(PxMax(PxU32(64), PxU32(slots.size()) * 2));
+	}
+
+	const PxU32 mask = PxU32(slots.size()) - 1;
+
+	for (PxU32 slot = Hash(actor0, actor1) & mask;; slot = (slot + 1) & mask)
+	{
+		const PxU32 index = slots[slot];
+
+		if (!index)
+		{
+			Entry entry = {};
+			entry.actor0 = actor0;
+			entry.actor1 = actor1;
+			entries.push_back(entry);
+			slots[slot] = PxU32(entries.size());
+			return entries.back();
+		}
+
+		Entry& entry = entries[index - 1];
+
+		if (entry.actor0 == actor0 && entry.actor1 == actor1)
+		{
+			return entry;
+		}
+	}
+}
+
+const ContactAggregator::Entry* ContactAggregator::Table::Find(const PxRigidActor* actor0, const PxRigidActor* actor1) const
+{
+	if (entries.empty())
+	{
+		return nullptr;
+	}
+
+	const PxU32 mask = PxU32(slots.size()) - 1;
+
+	for (PxU32 slot = Hash(actor0, actor1) & mask;; slot = (slot + 1) & mask)
+	{
+		const PxU32 index = slots[slot];
+
+		if (!index)
+		{
+			return nullptr;
+		}
+
+		const Entry& entry = entries[index - 1];
+
+		if (entry.actor0 == actor0 && entry.actor1 == actor1)
+		{
+			return &entry;
+		}
+	}
+}
+
+void ContactAggregator::Table::Rehash(PxU32 nbSlots)
+{
+	slots.assign(nbSlots, 0);
+
+	const PxU32 mask = nbSlots - 1;
+
+	for (PxU32 i = 0; i < entries.size(); i++)
+	{
+		PxU32 slot = Hash(entries[i].actor0, entries[i].actor1) & mask;
+
+		while (slots[slot])
+		{
+			slot = (slot + 1) & mask;
+		}
+
+		slots[slot] = i + 1;
+	}
+}
+
+void ContactAggregator::Table::Clear()
+{
+	if (entries.empty())
+	{
+		return;
+	}
+
+	entries.clear();
+	std::fill(slots.begin(), slots.end(), 0);
+}
+
+void ContactAggregator::Clear()
+{
+	for (auto& it : m_Locals)
+	{
+		it.Clear();
+	}
+
+	m_Merged.Clear();
+}
+
+void ContactAggregator::Add(const PxRigidActor* actor0, const PxRigidActor* actor1,
+	const PxVec3* positions, const PxVec3* normals, const PxVec3* impulses, PxU32 count)
+{
+	if (!count)
+	{
+		return;
+	}
+
+	//   ߰, ٲ  ִ  ȣ ´.
+	const bool flip = actor1 < actor0;
+	const PxReal sign = flip ? -1.0f : 1.0f;
+
+	if (flip)
+	{
+		std::swap(actor0, actor1);
+	}
+
+	PxVec3 impulse(0.0f);
+	PxVec3 pointSum(0.0f);
+	PxVec3 normalSum(0.0f);
+	PxReal totalImpulse = 0.0f;
+	PxReal maxImpulse = 0.0f;
+
+	for (PxU32 i = 0; i < count; i++)
+	{
+		const PxReal magnitude = impulses[i].magnitude();
+		impulse += impulses[i];
+		pointSum += positions[i];
+		normalSum += normals[i];
+		totalImpulse += magnitude;
+		maxImpulse = PxMax(maxImpulse, magnitude);
+	}
+
+	Table& table = m_Locals[ContactBuffer::GetThreadIndex() % ContactBuffer::MAX_THREADS];
+	Entry& entry = table.Insert(actor0, actor1);
+
+	entry.impulse += impulse * sign;
+	entry.totalImpulse += totalImpulse;
+	entry.maxImpulse = PxMax(entry.maxImpulse, maxImpulse);
+	entry.pointSum += pointSum;
+	entry.normalSum += normalSum * sign;
+	entry.nbPoints += count;
+}
+
+void ContactAggregator::Merge()
+{
+	for (auto& local : m_Locals)
+	{
+		for (const Entry& it : local.entries)
+		{
+			Entry& entry = m_Merged.Insert(it.actor0, it.actor1);
+
+			entry.impulse += it.impulse;
+			entry.totalImpulse += it.totalImpulse;
+			entry.maxImpulse = PxMax(entry.maxImpulse, it.maxImpulse);
+			entry.pointSum += it.pointSum;
+			entry.normalSum += it.normalSum;
+			entry.nbPoints += it.nbPoints;
+		}
+
+		local.Clear();
+	}
+}
+
+const ContactAggregator::Entry* ContactAggregator::Find(const PxRigidActor* actor0, const PxRigidActor* actor1) const
+{
+	if (actor1 < actor0)
+	{
+		std::swap(actor0, actor1);
+	}
+
+	return m_Merged.Find(actor0, actor1);
+}
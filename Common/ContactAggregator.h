@@ -0,0 +1,80 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+
+#include "ContactBuffer.h"
+
+/*
+	  ָ ϳ ٿ   ̺.
+
+	onContact  Add()  ȣ   ̺ ǰ,
+	ݹ    Merge()  ̺ ϳ ģ.  Find()   O(1) ã´.
+	̺  Ž  巹̰ Clear() ص 뷮 ´.
+
+	    Ͱ actor0  ǵ Ѵ.  ݷ ͵    Ƿ
+	׻ actor1  actor0  Ѵ.
+
+	
+		 	: aggregator.Clear();
+		onContact	: aggregator.Add(pairHeader.actors[0], pairHeader.actors[1], positions, normals, impulses, count);
+		ݹ Ϸ 	: aggregator.Merge();
+		 		: if (const ContactAggregator::Entry* entry = aggregator.Find(a, b)) ...
+*/
+
+class ContactAggregator
+{
+public:
+	struct Entry
+	{
+		const physx::PxRigidActor*	actor0;
+		const physx::PxRigidActor*	actor1;
+		physx::PxVec3				impulse;		// ݷ  
+		physx::PxReal				totalImpulse;	// ݷ ũ 
+		physx::PxReal				maxImpulse;
+		physx::PxVec3				pointSum;
+		physx::PxVec3				normalSum;
+		physx::PxU32				nbPoints;
+
+		physx::PxVec3 GetAveragePoint() const { return nbPoints ? pointSum / physx::PxReal(nbPoints) : physx::PxVec3(0.0f); }
+		physx::PxVec3 GetAverageNormal() const { return normalSum.getNormalized(); }
+	};
+
+public:
+	ContactAggregator() = default;
+	~ContactAggregator() = default;
+
+	void Clear();
+
+	// onContact ȿ ȣ.  忡 ÿ ҷ ȴ.
+	void Add(const physx::PxRigidActor* actor0, const physx::PxRigidActor* actor1,
+		const physx::PxVec3* positions, const physx::PxVec3* normals, const physx::PxVec3* impulses, physx::PxU32 count);
+
+	// ݹ     忡 ȣ.
+	void Merge();
+
+	const Entry*	Find(const physx::PxRigidActor* actor0, const physx::PxRigidActor* actor1) const;
+	physx::PxU32	GetNbEntries() const { return physx::PxU32(m_Merged.entries.size()); }
+	const Entry&	GetEntry(physx::PxU32 index) const { return m_Merged.entries[index]; }
+
+private:
+	// slots  entries ε + 1  ִ´. 0 ̸  ĭ.
+	struct alignas(64) Table
+	{
+		std::vector<physx::PxU32>	slots;
+		std::vector<Entry>			entries;
+
+		Entry&			Insert(const physx::PxRigidActor* actor0, const physx::PxRigidActor* actor1);
+		const Entry*	Find(const physx::PxRigidActor* actor0, const physx::PxRigidActor* actor1) const;
+		void			Rehash(physx::PxU32 nbSlots);
+		void			Clear();
+	};
+
+	static physx::PxU32 Hash(const physx::PxRigidActor* actor0, const physx::PxRigidActor* actor1);
+
+private:
+	Table	m_Locals[ContactBuffer::MAX_THREADS];
+	Table	m_Merged;
+};
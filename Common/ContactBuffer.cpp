@@ -0,0 +1,174 @@
+#include "ContactBuffer.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+
+using namespace physx;
+
+namespace
+{
+	//   ȣ  ξٰ  忡 ٽ ش.
+	//  ִ 峢 ȣ ġ Ƿ,  ִ 尡 MAX_THREADS  ϸ Writer     .
+	class ThreadSlots
+	{
+	public:
+		PxU32 Acquire()
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+
+			if (m_Free.empty())
+			{
+				// ȣ   Writer  庰 Ͱ   ġǷ  .
+				if (m_NbSlots >= ContactBuffer::MAX_THREADS)
+				{
+					char message[128];
+					snprintf(message, sizeof(message), "ContactBuffer: more than %u threads are alive at once.", ContactBuffer::MAX_THREADS);
+					PxGetFoundation().getErrorCallback().reportError(PxErrorCode::eABORT, message, __FILE__, __LINE__);
+					std::abort();
+				}
+
+				return m_NbSlots++;
+			}
+
+			const PxU32 index = m_Free.back();
+			m_Free.pop_back();
+			return index;
+		}
+
+		void Release(PxU32 index)
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Free.push_back(index);
+		}
+
+	private:
+		std::mutex			m_Mutex;
+		std::vector<PxU32>	m_Free;
+		PxU32				m_NbSlots = 0;
+	};
+
+	ThreadSlots& GetThreadSlots()
+	{
+		static ThreadSlots slots;
+		return slots;
+	}
+
+	// 帶 ó     ȣ ް, 尡   ش.
+	struct ThreadSlot
+	{
+		ThreadSlot() : index(GetThreadSlots().Acquire()) {}
+		~ThreadSlot() { GetThreadSlots().Release(index); }
+
+		PxU32 index;
+	};
+
+	thread_local ThreadSlot tThreadSlot;
+}
+
+ContactBuffer::Writer::~Writer()
+{
+	for (auto& it : m_Chunks)
+	{
+		delete it;
+	}
+}
+
+void ContactBuffer::Writer::NextChunk()
+{
+	if (m_NbUsed == m_Chunks.size())
+	{
+		m_Chunks.push_back(new Chunk());
+	}
+
+	m_Current = m_Chunks[m_NbUsed++];
+	m_Current->count = 0;
+}
+
+void ContactBuffer::Writer::Reset()
+{
+	m_Current = nullptr;
+	m_NbUsed = 0;
+}
+
+ContactBuffer::Writer& ContactBuffer::GetWriter()
+{
+	return m_Writers[tThreadSlot.index % MAX_THREADS];
+}
+
+PxU32 ContactBuffer::GetThreadIndex()
+{
+	return tThreadSlot.index;
+}
+
+void ContactBuffer::Reset()
+{
+	for (auto& it : m_Writers)
+	{
+		it.Reset();
+	}
+}
+
+PxU32 ContactBuffer::GetNbContacts() const
+{
+	PxU32 count = 0;
+
+	for (auto& writer : m_Writers)
+	{
+		for (PxU32 i = 0; i < writer.m_NbUsed; i++)
+		{
+			count += writer.m_Chunks[i]->count;
+		}
+	}
+
+	return count;
+}
+
+PxU32 ContactBuffer::GetNbSpans() const
+{
+	PxU32 count = 0;
+
+	for (auto& writer : m_Writers)
+	{
+		count += writer.m_NbUsed;
+	}
+
+	return count;
+}
+
+ContactBuffer::Span ContactBuffer::GetSpan(PxU32 index) const
+{
+	for (auto& writer : m_Writers)
+	{
+		if (index < writer.m_NbUsed)
+		{
+			const Chunk* chunk = writer.m_Chunks[index];
+			return { chunk->positions, chunk->impulses, chunk->count };
+		}
+
+		index -= writer.m_NbUsed;
+	}
+
+	PX_ASSERT(false);
+	return { nullptr, nullptr, 0 };
+}
+
+void ContactBuffer::Merge(std::vector<PxVec3>& positions, std::vector<PxVec3>& impulses) const
+{
+	const PxU32 nbContacts = GetNbContacts();
+	positions.resize(nbContacts);
+	impulses.resize(nbContacts);
+
+	PxU32 offset = 0;
+
+	for (auto& writer : m_Writers)
+	{
+		for (PxU32 i = 0; i < writer.m_NbUsed; i++)
+		{
+			const Chunk* chunk = writer.m_Chunks[i];
+			PxMemCopy(&positions[offset], chunk->positions, sizeof(PxVec3) * chunk->count);
+			PxMemCopy(&impulses[offset], chunk->impulses, sizeof(PxVec3) * chunk->count);
+			offset += chunk->count;
+		}
+	}
+}
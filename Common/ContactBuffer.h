@@ -0,0 +1,97 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+
+/*
+	 ġ/ݷ Ŀ 庰  .
+
+	processCallbacks  onContact   忡 ÿ ҷ
+	  ڱ Writer  Ƿ ,  ε ʿ .
+	Writer  CHUNK_SIZE  ûũ ̾ ٿ þ, Reset() ûũ  ʰ Ѵ.
+	(ó   Ŀ Ҵ Ͼ ʴ´.)
+
+	ݹ   (fetchResults / fetchResultsFinish ) GetSpan() ̳ Merge() д´.
+
+	
+		onContact	: gContactBuffer.GetWriter().Push(position, impulse);
+		 	: gContactBuffer.Reset();
+*/
+
+class ContactBuffer
+{
+public:
+	static const physx::PxU32 CHUNK_SIZE = 4096;
+	static const physx::PxU32 MAX_THREADS = 128;
+
+	struct Chunk
+	{
+		physx::PxVec3	positions[CHUNK_SIZE];
+		physx::PxVec3	impulses[CHUNK_SIZE];
+		physx::PxU32	count;
+	};
+
+	// ûũ ϳ  ӵ .
+	struct Span
+	{
+		const physx::PxVec3*	positions;
+		const physx::PxVec3*	impulses;
+		physx::PxU32			count;
+	};
+
+	// ٸ  Writer  ĳö   ʵ Ѵ.
+	class alignas(64) Writer
+	{
+	public:
+		Writer() : m_Current(nullptr), m_NbUsed(0) {}
+		~Writer();
+
+		void Push(const physx::PxVec3& position, const physx::PxVec3& impulse)
+		{
+			if (!m_Current || m_Current->count == CHUNK_SIZE)
+			{
+				NextChunk();
+			}
+
+			const physx::PxU32 index = m_Current->count++;
+			m_Current->positions[index] = position;
+			m_Current->impulses[index] = impulse;
+		}
+
+	private:
+		friend class ContactBuffer;
+
+		void NextChunk();
+		void Reset();
+
+		Chunk*				m_Current;
+		std::vector<Chunk*>	m_Chunks;
+		physx::PxU32		m_NbUsed;
+	};
+
+public:
+	ContactBuffer() = default;
+	~ContactBuffer() = default;
+
+	// ȣ   Writer.
+	Writer& GetWriter();
+
+	// 帶 0 ٴ ȣ. 庰 ͸   .
+	//  ִ 峢 ġ ʰ,   ȣ  尡 ޴´.
+	// ÿ  ִ  MAX_THREADS    ȴ.   ˸ abort Ѵ.
+	static physx::PxU32 GetThreadIndex();
+
+	void Reset();
+
+	physx::PxU32	GetNbContacts() const;
+	physx::PxU32	GetNbSpans() const;
+	Span			GetSpan(physx::PxU32 index) const;
+
+	//   ӵ 迭 Ѵ.   .
+	void Merge(std::vector<physx::PxVec3>& positions, std::vector<physx::PxVec3>& impulses) const;
+
+private:
+	Writer m_Writers[MAX_THREADS];
+};
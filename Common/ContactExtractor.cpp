@@ -0,0 +1,85 @@
+#include "ContactExtractor.h"
+
+#if PX_SSE2
+#include <xmmintrin.h>
+#endif
+
+using namespace physx;
+
+PxU32 ContactExtractor::Extract(const PxContactPair& pair,
+	PxVec3* positions, PxVec3* normals, PxVec3* impulses, PxReal* separations)
+{
+	if (!pair.contactCount)
+	{
+		return 0;
+	}
+
+	PxContactStreamIterator iter(pair.contactPatches, pair.contactPoints, pair.getInternalFaceIndices(), pair.patchCount, pair.contactCount);
+
+	// ݷ   0 Ѵ.  б ʵ   0 д.
+	static const PxReal zero = 0.0f;
+	const bool hasImpulses = (pair.flags & PxContactPairFlag::eINTERNAL_HAS_IMPULSES) && pair.contactImpulses;
+	const PxReal* impulse = hasImpulses ? pair.contactImpulses : &zero;
+	const PxU32 impulseStep = hasImpulses ? 1 : 0;
+
+	PxU32 nbContacts = 0;
+
+	while (iter.hasNextPatch())
+	{
+		iter.nextPatch();
+
+		while (iter.hasNextContact())
+		{
+			iter.nextContact();
+
+#if PX_SSE2
+			//  Ʈ Ŀ  PxContact(ġ, и Ÿ) ϰ,
+			//  ڿ ʵ尡 ̾Ƿ 16Ʈ о ϴ.
+			const __m128 point = _mm_loadu_ps(&iter.getContactPoint().x);
+			const __m128 normal = _mm_loadu_ps(&iter.getContactNormal().x);
+
+			_mm_storeu_ps(&positions[nbContacts].x, point);
+			_mm_storeu_ps(&normals[nbContacts].x, normal);
+			_mm_storeu_ps(&impulses[nbContacts].x, _mm_mul_ps(normal, _mm_set1_ps(*impulse)));
+			_mm_store_ss(&separations[nbContacts], _mm_shuffle_ps(point, point, _MM_SHUFFLE(3, 3, 3, 3)));
+#else
+			const PxVec3& normal = iter.getContactNormal();
+			positions[nbContacts] = iter.getContactPoint();
+			normals[nbContacts] = normal;
+			impulses[nbContacts] = normal * *impulse;
+			separations[nbContacts] = iter.getSeparation();
+#endif
+
+			impulse += impulseStep;
+			nbContacts++;
+		}
+	}
+
+	return nbContacts;
+}
+
+void ContactSoA::Reserve(PxU32 size)
+{
+	//    ĭ  д.
+	if (m_Positions.size() >= size + 1)
+	{
+		return;
+	}
+
+	const size_t capacity = PxMax(size_t(size + 1), m_Positions.size() * 2);
+	m_Positions.resize(capacity);
+	m_Normals.resize(capacity);
+	m_Impulses.resize(capacity);
+	m_Separations.resize(capacity);
+}
+
+PxU32 ContactSoA::Append(const PxContactPair& pair)
+{
+	Reserve(m_Size + ContactExtractor::GetNbContacts(pair));
+
+	const PxU32 nbContacts = ContactExtractor::Extract(pair,
+		&m_Positions[m_Size], &m_Normals[m_Size], &m_Impulses[m_Size], &m_Separations[m_Size]);
+
+	m_Size += nbContacts;
+	return nbContacts;
+}
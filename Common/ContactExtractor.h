@@ -0,0 +1,54 @@
+#pragma once
+
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+
+/*
+	PxContactPair   Ʈ PxContactStreamIterator   Ⱦ SoA 迭 Ǫ ƿƼ.
+
+	extractContacts  PxContactPairPoint(AoS)  ũ⸸ŭ Ǯ, ٽ   ƾ Ѵ.
+	⼭ Ʈ ٷ ġ//ݷ/и Ÿ  Ƿ     .
+	(PxContactPair::contactCount  ִ 255 .)
+
+	SSE2  (ġ + и Ÿ)  16Ʈ а, PxVec3  16Ʈ  .
+	׷  PxVec3     ĭ  ־ Ѵ. ContactSoA    ˾Ƽ ´.
+*/
+
+namespace ContactExtractor
+{
+	//   . extractContacts  ޸ ߸ ʴ´.
+	inline physx::PxU32 GetNbContacts(const physx::PxContactPair& pair) { return pair.contactCount; }
+
+	//  迭 GetNbContacts(pair) + 1 ĭ ־ Ѵ. Ǭ   ش.
+	physx::PxU32 Extract(const physx::PxContactPair& pair,
+		physx::PxVec3* positions, physx::PxVec3* normals, physx::PxVec3* impulses, physx::PxReal* separations);
+}
+
+// Ӹ Clear ϰ ٽ  SoA  迭. 뷮  ʴ´.
+class ContactSoA
+{
+public:
+	ContactSoA() : m_Size(0) {}
+
+	void Clear() { m_Size = 0; }
+
+	//    ̰   ش.
+	physx::PxU32 Append(const physx::PxContactPair& pair);
+
+	physx::PxU32			GetSize() const { return m_Size; }
+	const physx::PxVec3*	GetPositions() const { return m_Positions.data(); }
+	const physx::PxVec3*	GetNormals() const { return m_Normals.data(); }
+	const physx::PxVec3*	GetImpulses() const { return m_Impulses.data(); }
+	const physx::PxReal*	GetSeparations() const { return m_Separations.data(); }
+
+private:
+	void Reserve(physx::PxU32 size);
+
+private:
+	std::vector<physx::PxVec3>	m_Positions;
+	std::vector<physx::PxVec3>	m_Normals;
+	std::vector<physx::PxVec3>	m_Impulses;
+	std::vector<physx::PxReal>	m_Separations;
+	physx::PxU32				m_Size;
+};
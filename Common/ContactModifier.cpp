@@ -0,0 +1,298 @@
+#include "ContactModifier.h"
+
+#include "SnippetUtils.h"
+
+using namespace physx;
+
+ContactModifier::ContactModifier()
+	: m_NbRules(0)
+	, m_NbCalls(0)
+	, m_NbPairs(0)
+	, m_NbContacts(0)
+	, m_Ticks(0)
+	, m_LastStats()
+{
+	for (auto& it : m_Data.pairMasks)
+	{
+		it = 0;
+	}
+
+	for (auto& row : m_Table)
+	{
+		for (auto& it : row)
+		{
+			it.rule = INVALID_RULE;
+			it.owner = 0;
+		}
+	}
+}
+
+ContactModifier::Rule ContactModifier::FrictionRule(PxReal staticFriction, PxReal dynamicFriction)
+{
+	Rule rule = {};
+	rule.flags = MODIFY_FRICTION;
+	rule.staticFriction = staticFriction;
+	rule.dynamicFriction = dynamicFriction;
+	return rule;
+}
+
+ContactModifier::Rule ContactModifier::RestitutionRule(PxReal restitution)
+{
+	Rule rule = {};
+	rule.flags = MODIFY_RESTITUTION;
+	rule.restitution = PxClamp(restitution, 0.0f, 1.0f);
+	return rule;
+}
+
+ContactModifier::Rule ContactModifier::ConveyorRule(const PxVec3& localVelocity)
+{
+	Rule rule = {};
+	rule.flags = MODIFY_TARGET_VELOCITY;
+	rule.targetVelocity = localVelocity;
+	return rule;
+}
+
+PxU32 ContactModifier::AddRule(PxU32 class0, PxU32 class1, const Rule& rule)
+{
+	if (m_NbRules == MAX_RULES || class0 >= MAX_CLASSES || class1 >= MAX_CLASSES)
+	{
+		return INVALID_RULE;
+	}
+
+	const PxU32 index = m_NbRules++;
+	m_Rules[index] = rule;
+
+	//  ֿ ٽ ϸ  Ģ ̱.
+	m_Table[class0][class1].rule = PxU8(index);
+	m_Table[class0][class1].owner = 0;
+	m_Table[class1][class0].rule = PxU8(index);
+	m_Table[class1][class0].owner = class0 == class1 ? 0 : 1;
+
+	m_Data.pairMasks[class0] |= 1u << class1;
+	m_Data.pairMasks[class1] |= 1u << class0;
+
+	return index;
+}
+
+PxU32 ContactModifier::AddMaterialRule(const PxMaterial& material0, const PxMaterial& material1, const Rule& rule)
+{
+	const PxU32 class0 = GetMaterialClass(material0);
+	const PxU32 class1 = GetMaterialClass(material1);
+	return AddRule(class0, class1, rule);
+}
+
+void ContactModifier::SetRule(PxU32 ruleIndex, const Rule& rule)
+{
+	// ݹ д ߿ ٲ ʵ simulate ۿ ȣѴ.
+	PX_ASSERT(ruleIndex < m_NbRules);
+	m_Rules[ruleIndex] = rule;
+}
+
+PxU32 ContactModifier::GetMaterialClass(const PxMaterial& material)
+{
+	for (PxU32 i = 0; i < m_Materials.size(); i++)
+	{
+		if (m_Materials[i] == &material)
+		{
+			return MAX_CLASSES - 1 - i;
+		}
+	}
+
+	if (m_Materials.size() == MAX_CLASSES)
+	{
+		return MAX_CLASSES;
+	}
+
+	m_Materials.push_back(&material);
+	return MAX_CLASSES - PxU32(m_Materials.size());
+}
+
+void ContactModifier::TagShape(PxShape& shape) const
+{
+	PxMaterial* material = nullptr;
+
+	if (shape.getMaterials(&material, 1) == 0)
+	{
+		return;
+	}
+
+	for (PxU32 i = 0; i < m_Materials.size(); i++)
+	{
+		if (m_Materials[i] == material)
+		{
+			SetShapeClass(shape, MAX_CLASSES - 1 - i);
+			return;
+		}
+	}
+}
+
+void ContactModifier::TagActor(PxRigidActor& actor) const
+{
+	PxShape* shapes[16];
+	const PxU32 nbShapes = actor.getNbShapes();
+
+	for (PxU32 i = 0; i < nbShapes; i += 16)
+	{
+		const PxU32 nbRead = actor.getShapes(shapes, 16, i);
+
+		for (PxU32 j = 0; j < nbRead; j++)
+		{
+			TagShape(*shapes[j]);
+		}
+	}
+}
+
+void ContactModifier::ApplyTo(PxSceneDesc& sceneDesc)
+{
+	sceneDesc.filterShader = FilterShader;
+	sceneDesc.filterShaderData = &m_Data;
+	sceneDesc.filterShaderDataSize = sizeof(m_Data);
+	sceneDesc.contactModifyCallback = this;
+}
+
+void ContactModifier::BeginFrame()
+{
+	m_LastStats.nbCalls = m_NbCalls.exchange(0);
+	m_LastStats.nbPairs = m_NbPairs.exchange(0);
+	m_LastStats.nbContacts = m_NbContacts.exchange(0);
+	m_LastStats.milliseconds = SnippetUtils::getElapsedTimeInMilliseconds(m_Ticks.exchange(0));
+}
+
+void ContactModifier::SetShapeClass(PxShape& shape, PxU32 modifyClass)
+{
+	PX_ASSERT(modifyClass < MAX_CLASSES);
+
+	PxFilterData filterData = shape.getSimulationFilterData();
+	filterData.word2 = modifyClass;
+	shape.setSimulationFilterData(filterData);
+}
+
+void ContactModifier::SetActorClass(PxRigidActor& actor, PxU32 modifyClass)
+{
+	PxShape* shapes[16];
+	const PxU32 nbShapes = actor.getNbShapes();
+
+	for (PxU32 i = 0; i < nbShapes; i += 16)
+	{
+		const PxU32 nbRead = actor.getShapes(shapes, 16, i);
+
+		for (PxU32 j = 0; j < nbRead; j++)
+		{
+			SetShapeClass(*shapes[j], modifyClass);
+		}
+	}
+}
+
+PxFilterFlags ContactModifier::FilterShader(
+	PxFilterObjectAttributes attributes0, PxFilterData filterData0,
+	PxFilterObjectAttributes attributes1, PxFilterData filterData1,
+	PxPairFlags& pairFlags, const void* constantBlock, PxU32)
+{
+	if (PxFilterObjectIsTrigger(attributes0) || PxFilterObjectIsTrigger(attributes1))
+	{
+		pairFlags = PxPairFlag::eTRIGGER_DEFAULT;
+		return PxFilterFlag::eDEFAULT;
+	}
+
+	pairFlags = PxPairFlag::eCONTACT_DEFAULT;
+
+	const ShaderData& data = *static_cast<const ShaderData*>(constantBlock);
+
+	if (data.pairMasks[filterData0.word2 % MAX_CLASSES] & (1u << (filterData1.word2 % MAX_CLASSES)))
+	{
+		pairFlags |= PxPairFlag::eMODIFY_CONTACTS;
+	}
+
+	return PxFilterFlag::eDEFAULT;
+}
+
+void ContactModifier::onContactModify(PxContactModifyPair* const pairs, PxU32 count)
+{
+	//  忡 ÿ Ҹ  ִ.  ´    īͷθ ٷ.
+	const PxU64 start = SnippetUtils::getCurrentTimeCounterValue();
+
+	for (PxU32 i = 0; i < count; i += BATCH_SIZE)
+	{
+		ModifyBatch(pairs + i, PxMin(BATCH_SIZE, count - i));
+	}
+
+	PxU32 nbContacts = 0;
+
+	for (PxU32 i = 0; i < count; i++)
+	{
+		nbContacts += pairs[i].contacts.size();
+	}
+
+	m_NbCalls++;
+	m_NbPairs += count;
+	m_NbContacts += nbContacts;
+	m_Ticks += SnippetUtils::getCurrentTimeCounterValue() - start;
+}
+
+void ContactModifier::ModifyBatch(PxContactModifyPair* pairs, PxU32 count)
+{
+	// 1ܰ: ָ Ģ ã  SoA  .
+	// ̾ ӵ ⼭  ǥ ٲٰ ȣ  д.
+	PxU32	flags[BATCH_SIZE];
+	PxReal	staticFriction[BATCH_SIZE];
+	PxReal	dynamicFriction[BATCH_SIZE];
+	PxReal	restitution[BATCH_SIZE];
+	PxVec3	velocity[BATCH_SIZE];
+
+	for (PxU32 i = 0; i < count; i++)
+	{
+		const PxContactModifyPair& pair = pairs[i];
+		const PxU32 class0 = pair.shape[0]->getSimulationFilterData().word2 % MAX_CLASSES;
+		const PxU32 class1 = pair.shape[1]->getSimulationFilterData().word2 % MAX_CLASSES;
+		const Entry entry = m_Table[class0][class1];
+
+		// ̴ Ŀ  Ͱ ٲ Ģ   ִ.  Ģ Ѵ.
+		static const Rule emptyRule = {};
+		const Rule& rule = entry.rule == INVALID_RULE ? emptyRule : m_Rules[entry.rule];
+
+		// ǥ ӵ 0 ٵ𿡼  1 ٵ  ӵ̹Ƿ ̾ 0̸ ȣ ´.
+		const PxReal sign = PxReal(entry.owner) * 2.0f - 1.0f;
+
+		flags[i] = rule.flags;
+		staticFriction[i] = rule.staticFriction;
+		dynamicFriction[i] = rule.dynamicFriction;
+		restitution[i] = rule.restitution;
+		velocity[i] = pair.transform[entry.owner].q.rotate(rule.targetVelocity) * sign;
+	}
+
+	// 2ܰ: Ӽ  ȴ´. б  θ ְ   ȿ .
+	for (PxU32 i = 0; i < count; i++)
+	{
+		PxContactSet& contacts = pairs[i].contacts;
+		const PxU32 nbContacts = contacts.size();
+
+		if (flags[i] & MODIFY_FRICTION)
+		{
+			for (PxU32 j = 0; j < nbContacts; j++)
+			{
+				contacts.setStaticFriction(j, staticFriction[i]);
+				contacts.setDynamicFriction(j, dynamicFriction[i]);
+			}
+		}
+
+		if (flags[i] & MODIFY_RESTITUTION)
+		{
+			for (PxU32 j = 0; j < nbContacts; j++)
+			{
+				contacts.setRestitution(j, restitution[i]);
+			}
+		}
+
+		if (flags[i] & MODIFY_TARGET_VELOCITY)
+		{
+			//      ӵ .
+			const PxVec3 v = velocity[i];
+
+			for (PxU32 j = 0; j < nbContacts; j++)
+			{
+				const PxVec3& n = contacts.getNormal(j);
+				contacts.setTargetVelocity(j, v - n * n.dot(v));
+			}
+		}
+	}
+}
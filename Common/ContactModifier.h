@@ -0,0 +1,127 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+
+/*
+	PxContactModifyCallback   Ģ   .
+
+	ùķ̼   word2   Ŭ(0 ~ MAX_CLASSES-1) ְ, Ŭ ָ Ģ ϳ Ѵ.
+	 ̴ Ģ ִ ֿ eMODIFY_CONTACTS  ѹǷ      ʴ´.
+	ApplyTo()   ̴ ° ٲٹǷ ContactReportPolicy::ApplyTo()      .
+	(word3  ContactReportPolicy  Ƿ  ͸ ġ ʴ´.)
+
+	 ε Ģ   ִ. AddMaterialRule()  Ŭ MAX_CLASSES-1  Ųٷ ϰ,
+	TagActor()/TagShape()  ù °   Ŭ  ִ´.
+
+	- MODIFY_FRICTION			: /   .
+	- MODIFY_RESTITUTION		: ݹ  .
+	- MODIFY_TARGET_VELOCITY	: ̾ Ʈ. ӵ Ģ Ű ù ° Ŭ   ǥ ش.
+
+	Ŭ  ̺ createScene  ̴ ͷ ǹǷ Ģ ߰ ApplyTo()   Ѵ.
+	Ģ (, ӵ ) Ŀ SetRule() ٲ  ִ.
+*/
+
+enum ContactModifyFlag : physx::PxU32
+{
+	MODIFY_NONE				= 0,
+	MODIFY_FRICTION			= 1 << 0,
+	MODIFY_RESTITUTION		= 1 << 1,
+	MODIFY_TARGET_VELOCITY	= 1 << 2,
+};
+
+class ContactModifier : public physx::PxContactModifyCallback
+{
+public:
+	static const physx::PxU32 MAX_CLASSES = 16;
+	static const physx::PxU32 MAX_RULES = 64;
+	static const physx::PxU32 INVALID_RULE = 0xff;
+
+	//   Ƽ óϴ  .  迭 ũ̱⵵ ϴ.
+	static const physx::PxU32 BATCH_SIZE = 64;
+
+	struct Rule
+	{
+		physx::PxU32	flags;
+		physx::PxReal	staticFriction;
+		physx::PxReal	dynamicFriction;
+		physx::PxReal	restitution;
+		physx::PxVec3	targetVelocity;
+	};
+
+	//  ̴ Ǿ Ѿ . Ʈ j    (i, j) ֿ Ģ ִ.
+	struct ShaderData
+	{
+		physx::PxU32 pairMasks[MAX_CLASSES];
+	};
+
+	struct FrameStats
+	{
+		physx::PxU32	nbCalls;
+		physx::PxU32	nbPairs;
+		physx::PxU32	nbContacts;
+		physx::PxReal	milliseconds;	//   
+	};
+
+public:
+	ContactModifier();
+	virtual ~ContactModifier() = default;
+
+	static Rule FrictionRule(physx::PxReal staticFriction, physx::PxReal dynamicFriction);
+	static Rule RestitutionRule(physx::PxReal restitution);
+	static Rule ConveyorRule(const physx::PxVec3& localVelocity);
+
+	// Ģ ȣ ش.     INVALID_RULE.
+	physx::PxU32 AddRule(physx::PxU32 class0, physx::PxU32 class1, const Rule& rule);
+	physx::PxU32 AddMaterialRule(const physx::PxMaterial& material0, const physx::PxMaterial& material1, const Rule& rule);
+	void SetRule(physx::PxU32 ruleIndex, const Rule& rule);
+
+	//   Ŭ  word2  ä.   ̸ ״ д.
+	void TagShape(physx::PxShape& shape) const;
+	void TagActor(physx::PxRigidActor& actor) const;
+
+	//  ̴, ̴ ,  ݹ sceneDesc  Ѵ. createScene  ȣ.
+	void ApplyTo(physx::PxSceneDesc& sceneDesc);
+
+	//   simulate  ȣ.   踦 ѱ ī͸ .
+	void BeginFrame();
+	const FrameStats& GetLastFrameStats() const { return m_LastStats; }
+
+	static void SetShapeClass(physx::PxShape& shape, physx::PxU32 modifyClass);
+	static void SetActorClass(physx::PxRigidActor& actor, physx::PxU32 modifyClass);
+
+	static physx::PxFilterFlags FilterShader(
+		physx::PxFilterObjectAttributes attributes0, physx::PxFilterData filterData0,
+		physx::PxFilterObjectAttributes attributes1, physx::PxFilterData filterData1,
+		physx::PxPairFlags& pairFlags, const void* constantBlock, physx::PxU32 constantBlockSize);
+
+	// PxContactModifyCallback
+	virtual void onContactModify(physx::PxContactModifyPair* const pairs, physx::PxU32 count) override;
+
+private:
+	// Ŭ  -> Ģ. owner  Ģ Ű ù ° Ŭ   ° .
+	struct Entry
+	{
+		physx::PxU8 rule;
+		physx::PxU8 owner;
+	};
+
+	void ModifyBatch(physx::PxContactModifyPair* pairs, physx::PxU32 count);
+	physx::PxU32 GetMaterialClass(const physx::PxMaterial& material);
+
+private:
+	ShaderData		m_Data;
+	Entry			m_Table[MAX_CLASSES][MAX_CLASSES];
+	Rule			m_Rules[MAX_RULES];
+	physx::PxU32	m_NbRules;
+
+	std::vector<const physx::PxMaterial*>	m_Materials;	// Ŭ = MAX_CLASSES - 1 - ε
+
+	std::atomic<physx::PxU32>	m_NbCalls;
+	std::atomic<physx::PxU32>	m_NbPairs;
+	std::atomic<physx::PxU32>	m_NbContacts;
+	std::atomic<physx::PxU64>	m_Ticks;
+	FrameStats					m_LastStats;
+};
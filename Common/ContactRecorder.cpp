@@ -0,0 +1,404 @@
+#include "ContactRecorder.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace physx;
+
+void ContactRecorder::ThreadColumns::Clear()
+{
+	// 뷮 ܼ  ӿ Ѵ.
+	actor0.clear();
+	actor1.clear();
+	events.clear();
+	pointCounts.clear();
+	positions.clear();
+	normals.clear();
+	impulses.clear();
+	separations.clear();
+}
+
+ContactRecorder::ContactRecorder()
+	: m_Stream(nullptr)
+	, m_Front(&m_Buffers[0])
+	, m_Pending(nullptr)
+	, m_FrameIndex(0)
+	, m_Thread(nullptr)
+	, m_WorkSync(nullptr)
+	, m_IdleSync(nullptr)
+	, m_Quit(false)
+	, m_NbFramesWritten(0)
+	, m_BytesWritten(0)
+	, m_LastWaitMs(0.0f)
+{
+}
+
+ContactRecorder::~ContactRecorder()
+{
+	Close();
+}
+
+bool ContactRecorder::Open(const char* path)
+{
+	Close();
+
+	m_Stream = new PxDefaultFileOutputStream(path);
+
+	if (!m_Stream->isValid())
+	{
+		delete m_Stream;
+		m_Stream = nullptr;
+		return false;
+	}
+
+	ContactLog::FileHeader header = {};
+	header.magic = ContactLog::FILE_MAGIC;
+	header.version = ContactLog::VERSION;
+	m_Stream->write(&header, sizeof(header));
+
+	for (auto& buffer : m_Buffers)
+	{
+		for (auto& it : buffer.threads)
+		{
+			it.Clear();
+		}
+	}
+
+	m_Front = &m_Buffers[0];
+	m_Pending = nullptr;
+	m_FrameIndex = 0;
+	m_NbFramesWritten = 0;
+	m_BytesWritten = sizeof(header);
+
+	m_Quit = false;
+	m_WorkSync = SnippetUtils::syncCreate();
+	m_IdleSync = SnippetUtils::syncCreate();
+	SnippetUtils::syncSet(m_IdleSync);
+	m_Thread = SnippetUtils::threadCreate(ThreadEntry, this);
+
+	return true;
+}
+
+void ContactRecorder::Close()
+{
+	if (!m_Stream)
+	{
+		return;
+	}
+
+	//  ִ      带 .
+	SnippetUtils::syncWait(m_IdleSync);
+	m_Quit = true;
+	SnippetUtils::syncSet(m_WorkSync);
+	SnippetUtils::threadWaitForQuit(m_Thread);
+	SnippetUtils::threadRelease(m_Thread);
+	SnippetUtils::syncRelease(m_WorkSync);
+	SnippetUtils::syncRelease(m_IdleSync);
+	m_Thread = nullptr;
+	m_WorkSync = nullptr;
+	m_IdleSync = nullptr;
+
+	delete m_Stream;
+	m_Stream = nullptr;
+}
+
+void ContactRecorder::Record(const PxContactPairHeader& pairHeader, const PxContactPair* pairs, PxU32 nbPairs)
+{
+	if (!m_Stream)
+	{
+		return;
+	}
+
+	ThreadColumns& columns = m_Front->threads[ContactBuffer::GetThreadIndex() % ContactBuffer::MAX_THREADS];
+
+	const PxU64 actor0 = PxU64(size_t(pairHeader.actors[0]));
+	const PxU64 actor1 = PxU64(size_t(pairHeader.actors[1]));
+
+	for (PxU32 i = 0; i < nbPairs; i++)
+	{
+		const PxContactPair& pair = pairs[i];
+
+		// Ʈ  ٷ Ǭ.    ĭ  ÷ȴٰ ǵ.
+		const size_t offset = columns.positions.size();
+		const size_t capacity = offset + ContactExtractor::GetNbContacts(pair) + 1;
+		columns.positions.resize(capacity);
+		columns.normals.resize(capacity);
+		columns.impulses.resize(capacity);
+		columns.separations.resize(capacity);
+
+		const PxU32 nbPoints = ContactExtractor::Extract(pair,
+			&columns.positions[offset], &columns.normals[offset], &columns.impulses[offset], &columns.separations[offset]);
+
+		columns.positions.resize(offset + nbPoints);
+		columns.normals.resize(offset + nbPoints);
+		columns.impulses.resize(offset + nbPoints);
+		columns.separations.resize(offset + nbPoints);
+
+		columns.actor0.push_back(actor0);
+		columns.actor1.push_back(actor1);
+		columns.events.push_back(PxU32(pair.events));
+		columns.pointCounts.push_back(nbPoints);
+	}
+}
+
+void ContactRecorder::EndFrame()
+{
+	if (!m_Stream)
+	{
+		return;
+	}
+
+	//      ٸ.
+	const PxU64 start = SnippetUtils::getCurrentTimeCounterValue();
+	SnippetUtils::syncWait(m_IdleSync);
+	m_LastWaitMs = SnippetUtils::getElapsedTimeInMilliseconds(SnippetUtils::getCurrentTimeCounterValue() - start);
+
+	SnippetUtils::syncReset(m_IdleSync);
+
+	m_Front->frameIndex = m_FrameIndex++;
+	m_Pending = m_Front;
+	m_Front = m_Front == &m_Buffers[0] ? &m_Buffers[1] : &m_Buffers[0];
+
+	SnippetUtils::syncSet(m_WorkSync);
+}
+
+//////////////////////////////////////////
+
+void ContactRecorder::ThreadEntry(void* data)
+{
+	static_cast<ContactRecorder*>(data)->ThreadLoop();
+}
+
+void ContactRecorder::ThreadLoop()
+{
+	for (;;)
+	{
+		SnippetUtils::syncWait(m_WorkSync);
+		SnippetUtils::syncReset(m_WorkSync);
+
+		if (m_Pending)
+		{
+			WriteFrame(*m_Pending);
+			m_Pending = nullptr;
+			SnippetUtils::syncSet(m_IdleSync);
+		}
+
+		if (m_Quit)
+		{
+			break;
+		}
+	}
+}
+
+template<typename T, typename Member>
+void ContactRecorder::WriteColumn(FrameBuffer& frame, Member member)
+{
+	for (auto& it : frame.threads)
+	{
+		const std::vector<T>& column = it.*member;
+
+		if (column.size())
+		{
+			m_Stream->write(&column[0], PxU32(sizeof(T) * column.size()));
+		}
+	}
+}
+
+void ContactRecorder::WriteFrame(FrameBuffer& frame)
+{
+	ContactLog::BlockHeader header = {};
+	header.magic = ContactLog::BLOCK_MAGIC;
+	header.frameIndex = frame.frameIndex;
+
+	for (auto& it : frame.threads)
+	{
+		header.nbPairs += PxU32(it.actor0.size());
+		header.nbPoints += PxU32(it.positions.size());
+	}
+
+	//          ´´.
+	m_Stream->write(&header, sizeof(header));
+	WriteColumn<PxU64>(frame, &ThreadColumns::actor0);
+	WriteColumn<PxU64>(frame, &ThreadColumns::actor1);
+	WriteColumn<PxU32>(frame, &ThreadColumns::events);
+	WriteColumn<PxU32>(frame, &ThreadColumns::pointCounts);
+	WriteColumn<PxVec3>(frame, &ThreadColumns::positions);
+	WriteColumn<PxVec3>(frame, &ThreadColumns::normals);
+	WriteColumn<PxVec3>(frame, &ThreadColumns::impulses);
+	WriteColumn<PxReal>(frame, &ThreadColumns::separations);
+
+	for (auto& it : frame.threads)
+	{
+		it.Clear();
+	}
+
+	m_BytesWritten += ContactLog::GetBlockSize(header.nbPairs, header.nbPoints);
+	m_NbFramesWritten++;
+}
+
+//////////////////////////////////////////
+
+ContactLogReader::ContactLogReader()
+	: m_Data(nullptr)
+	, m_Size(0)
+	, m_File(nullptr)
+	, m_Mapping(nullptr)
+{
+}
+
+ContactLogReader::~ContactLogReader()
+{
+	Close();
+}
+
+bool ContactLogReader::Open(const char* path)
+{
+	Close();
+
+#ifdef _WIN32
+	HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER size;
+	HANDLE mapping = GetFileSizeEx(file, &size) && size.QuadPart ? CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL) : NULL;
+
+	if (!mapping)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	m_File = file;
+	m_Mapping = mapping;
+	m_Size = PxU64(size.QuadPart);
+	m_Data = static_cast<const PxU8*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+#else
+	const int file = open(path, O_RDONLY);
+
+	if (file < 0)
+	{
+		return false;
+	}
+
+	struct stat info;
+
+	if (fstat(file, &info) != 0 || info.st_size == 0)
+	{
+		close(file);
+		return false;
+	}
+
+	void* data = mmap(NULL, size_t(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+	close(file);
+
+	m_Size = PxU64(info.st_size);
+	m_Data = data == MAP_FAILED ? nullptr : static_cast<const PxU8*>(data);
+#endif
+
+	if (!m_Data || m_Size < sizeof(ContactLog::FileHeader))
+	{
+		Close();
+		return false;
+	}
+
+	const ContactLog::FileHeader* fileHeader = reinterpret_cast<const ContactLog::FileHeader*>(m_Data);
+
+	if (fileHeader->magic != ContactLog::FILE_MAGIC || fileHeader->version != ContactLog::VERSION)
+	{
+		Close();
+		return false;
+	}
+
+	//  ߿  ̸   ߷  Ƿ  ϱ д´.
+	PxU64 offset = sizeof(ContactLog::FileHeader);
+
+	while (offset + sizeof(ContactLog::BlockHeader) <= m_Size)
+	{
+		const ContactLog::BlockHeader* header = reinterpret_cast<const ContactLog::BlockHeader*>(m_Data + offset);
+		const PxU64 blockSize = ContactLog::GetBlockSize(header->nbPairs, header->nbPoints);
+
+		if (header->magic != ContactLog::BLOCK_MAGIC || offset + blockSize > m_Size)
+		{
+			break;
+		}
+
+		m_Frames.push_back(offset);
+		offset += blockSize;
+	}
+
+	return true;
+}
+
+void ContactLogReader::Close()
+{
+	Unmap();
+	m_Frames.clear();
+}
+
+ContactLogReader::Frame ContactLogReader::GetFrame(PxU32 index) const
+{
+	const PxU8* block = m_Data + m_Frames[index];
+	const ContactLog::BlockHeader* header = reinterpret_cast<const ContactLog::BlockHeader*>(block);
+
+	const PxU32 nbPairs = header->nbPairs;
+	const PxU32 nbPoints = header->nbPoints;
+
+	Frame frame;
+	frame.frameIndex = header->frameIndex;
+	frame.nbPairs = nbPairs;
+	frame.nbPoints = nbPoints;
+
+	const PxU8* column = block + sizeof(ContactLog::BlockHeader);
+	frame.actor0 = reinterpret_cast<const PxU64*>(column);			column += sizeof(PxU64) * nbPairs;
+	frame.actor1 = reinterpret_cast<const PxU64*>(column);			column += sizeof(PxU64) * nbPairs;
+	frame.events = reinterpret_cast<const PxU32*>(column);			column += sizeof(PxU32) * nbPairs;
+	frame.pointCounts = reinterpret_cast<const PxU32*>(column);		column += sizeof(PxU32) * nbPairs;
+	frame.positions = reinterpret_cast<const PxVec3*>(column);		column += sizeof(PxVec3) * nbPoints;
+	frame.normals = reinterpret_cast<const PxVec3*>(column);		column += sizeof(PxVec3) * nbPoints;
+	frame.impulses = reinterpret_cast<const PxVec3*>(column);		column += sizeof(PxVec3) * nbPoints;
+	frame.separations = reinterpret_cast<const PxReal*>(column);
+
+	return frame;
+}
+
+void ContactLogReader::Unmap()
+{
+#ifdef _WIN32
+	if (m_Data)
+	{
+		UnmapViewOfFile(m_Data);
+	}
+
+	if (m_Mapping)
+	{
+		CloseHandle(m_Mapping);
+	}
+
+	if (m_File)
+	{
+		CloseHandle(m_File);
+	}
+#else
+	if (m_Data)
+	{
+		munmap(const_cast<PxU8*>(m_Data), size_t(m_Size));
+	}
+#endif
+
+	m_Data = nullptr;
+	m_Size = 0;
+	m_File = nullptr;
+	m_Mapping = nullptr;
+}
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+
+#include "ContactBuffer.h"
+#include "ContactExtractor.h"
+#include "SnippetUtils.h"
+
+/*
+	  Ϸ  ϱ,  ޸ ؼ д .
+
+	  (Ʋ )
+		FileHeader
+		  * N
+			BlockHeader
+			actor0[nbPairs] (PxU64), actor1[nbPairs] (PxU64)		 ּ.    ȿ    ʹ.
+			events[nbPairs] (PxU32), pointCounts[nbPairs] (PxU32)	PxPairFlags,   
+			positions[nbPoints], normals[nbPoints], impulses[nbPoints] (PxVec3)
+			separations[nbPoints] (PxReal)
+		ʵ帶  ϹǷ ʿ  Ⱦ  ִ.  ũ ׻ 8 .
+
+	
+		onContact  Record() θ ȣ   ۿ ̹Ƿ  ݹ鿡  ʴ´.
+		ݹ   EndFrame() θ ۸ ٲٰ( ) ׶ 尡 Ͽ .
+		Ⱑ  Ӻ  ɸ EndFrame() ٸ,  ð GetLastWaitMilliseconds()   ִ.
+*/
+
+namespace ContactLog
+{
+	static const physx::PxU32 FILE_MAGIC = 0x474f4c43;	// "CLOG"
+	static const physx::PxU32 BLOCK_MAGIC = 0x4d524643;	// "CFRM"
+	static const physx::PxU32 VERSION = 1;
+
+	struct FileHeader
+	{
+		physx::PxU32 magic;
+		physx::PxU32 version;
+		physx::PxU32 reserved[2];
+	};
+
+	struct BlockHeader
+	{
+		physx::PxU32 magic;
+		physx::PxU32 frameIndex;
+		physx::PxU32 nbPairs;
+		physx::PxU32 nbPoints;
+	};
+
+	inline physx::PxU64 GetBlockSize(physx::PxU32 nbPairs, physx::PxU32 nbPoints)
+	{
+		return sizeof(BlockHeader)
+			+ physx::PxU64(nbPairs) * (sizeof(physx::PxU64) * 2 + sizeof(physx::PxU32) * 2)
+			+ physx::PxU64(nbPoints) * (sizeof(physx::PxVec3) * 3 + sizeof(physx::PxReal));
+	}
+}
+
+class ContactRecorder
+{
+public:
+	ContactRecorder();
+	~ContactRecorder();
+
+	bool Open(const char* path);
+
+	//  EndFrame Ŀ ϵ  .
+	void Close();
+
+	bool IsOpen() const { return m_Stream != nullptr; }
+
+	// onContact  ȣ.
+	void Record(const physx::PxContactPairHeader& pairHeader, const physx::PxContactPair* pairs, physx::PxU32 nbPairs);
+
+	// ݹ   (fetchResults / fetchResultsFinish )   ȣ.
+	void EndFrame();
+
+	physx::PxU32	GetNbFramesWritten() const { return m_NbFramesWritten; }
+	physx::PxU64	GetBytesWritten() const { return m_BytesWritten; }
+	physx::PxReal	GetLastWaitMilliseconds() const { return m_LastWaitMs; }
+
+private:
+	struct alignas(64) ThreadColumns
+	{
+		std::vector<physx::PxU64>	actor0;
+		std::vector<physx::PxU64>	actor1;
+		std::vector<physx::PxU32>	events;
+		std::vector<physx::PxU32>	pointCounts;
+		std::vector<physx::PxVec3>	positions;
+		std::vector<physx::PxVec3>	normals;
+		std::vector<physx::PxVec3>	impulses;
+		std::vector<physx::PxReal>	separations;
+
+		void Clear();
+	};
+
+	struct FrameBuffer
+	{
+		physx::PxU32	frameIndex;
+		ThreadColumns	threads[ContactBuffer::MAX_THREADS];
+	};
+
+	static void ThreadEntry(void* data);
+	void ThreadLoop();
+	void WriteFrame(FrameBuffer& frame);
+
+	template<typename T, typename Member>
+	void WriteColumn(FrameBuffer& frame, Member member);
+
+private:
+	physx::PxDefaultFileOutputStream*	m_Stream;
+
+	FrameBuffer		m_Buffers[2];
+	FrameBuffer*	m_Front;	// ݹ  
+	FrameBuffer*	m_Pending;	// ׶ 尡  
+	physx::PxU32	m_FrameIndex;
+
+	physx::SnippetUtils::Thread*	m_Thread;
+	physx::SnippetUtils::Sync*		m_WorkSync;	//   
+	physx::SnippetUtils::Sync*		m_IdleSync;	// ׶ 尡  
+	std::atomic<bool>				m_Quit;
+
+	std::atomic<physx::PxU32>	m_NbFramesWritten;
+	std::atomic<physx::PxU64>	m_BytesWritten;
+	physx::PxReal				m_LastWaitMs;
+};
+
+class ContactLogReader
+{
+public:
+	struct Frame
+	{
+		physx::PxU32			frameIndex;
+		physx::PxU32			nbPairs;
+		physx::PxU32			nbPoints;
+		const physx::PxU64*		actor0;
+		const physx::PxU64*		actor1;
+		const physx::PxU32*		events;
+		const physx::PxU32*		pointCounts;
+		const physx::PxVec3*	positions;
+		const physx::PxVec3*	normals;
+		const physx::PxVec3*	impulses;
+		const physx::PxReal*	separations;
+	};
+
+public:
+	ContactLogReader();
+	~ContactLogReader();
+
+	//  ϰ   󰡸鼭  ġ .
+	bool Open(const char* path);
+	void Close();
+
+	physx::PxU32	GetNbFrames() const { return physx::PxU32(m_Frames.size()); }
+	Frame			GetFrame(physx::PxU32 index) const;
+
+private:
+	void Unmap();
+
+private:
+	const physx::PxU8*			m_Data;
+	physx::PxU64				m_Size;
+	std::vector<physx::PxU64>	m_Frames;	//  
+
+	void*	m_File;		// ÷ ڵ
+	void*	m_Mapping;
+};
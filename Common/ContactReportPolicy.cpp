@@ -0,0 +1,106 @@
+#include "ContactReportPolicy.h"
+
+using namespace physx;
+
+ContactReportPolicy::ContactReportPolicy()
+	: m_PersistInterval(1)
+	, m_Frame(0)
+{
+	for (auto& it : m_Data.classFlags)
+	{
+		it = CONTACT_REPORT_NONE;
+	}
+}
+
+void ContactReportPolicy::SetClassFlags(PxU32 reportClass, PxU32 flags)
+{
+	PX_ASSERT(reportClass < MAX_CLASSES);
+	m_Data.classFlags[reportClass] = flags;
+}
+
+void ContactReportPolicy::ApplyTo(PxSceneDesc& sceneDesc) const
+{
+	// ̴ ʹ createScene  ǹǷ Ŀ ٲ Ŭ  ݿ ʴ´.
+	sceneDesc.filterShader = FilterShader;
+	sceneDesc.filterShaderData = &m_Data;
+	sceneDesc.filterShaderDataSize = sizeof(m_Data);
+}
+
+bool ContactReportPolicy::ShouldProcess(const PxContactPair& pair) const
+{
+	const PxPairFlags persists = PxPairFlag::eNOTIFY_TOUCH_PERSISTS | PxPairFlag::eNOTIFY_THRESHOLD_FORCE_PERSISTS;
+
+	if (m_PersistInterval <= 1 || (pair.events & ~persists))
+	{
+		return true;
+	}
+
+	//  ּҷ  ó  ´.
+	const size_t hash = (size_t(pair.shapes[0]) >> 4) ^ ((size_t(pair.shapes[1]) >> 4) * 2654435761u);
+	return (hash + m_Frame) % m_PersistInterval == 0;
+}
+
+void ContactReportPolicy::SetShapeClass(PxShape& shape, PxU32 reportClass)
+{
+	PxFilterData filterData = shape.getSimulationFilterData();
+	filterData.word3 = reportClass;
+	shape.setSimulationFilterData(filterData);
+}
+
+void ContactReportPolicy::SetActorClass(PxRigidActor& actor, PxU32 reportClass)
+{
+	PxShape* shapes[16];
+	const PxU32 nbShapes = actor.getNbShapes();
+
+	for (PxU32 i = 0; i < nbShapes; i += 16)
+	{
+		const PxU32 nbRead = actor.getShapes(shapes, 16, i);
+
+		for (PxU32 j = 0; j < nbRead; j++)
+		{
+			SetShapeClass(*shapes[j], reportClass);
+		}
+	}
+}
+
+PxFilterFlags ContactReportPolicy::FilterShader(
+	PxFilterObjectAttributes attributes0, PxFilterData filterData0,
+	PxFilterObjectAttributes attributes1, PxFilterData filterData1,
+	PxPairFlags& pairFlags, const void* constantBlock, PxU32)
+{
+	if (PxFilterObjectIsTrigger(attributes0) || PxFilterObjectIsTrigger(attributes1))
+	{
+		pairFlags = PxPairFlag::eTRIGGER_DEFAULT;
+		return PxFilterFlag::eDEFAULT;
+	}
+
+	pairFlags = PxPairFlag::eCONTACT_DEFAULT;
+
+	const ShaderData& data = *static_cast<const ShaderData*>(constantBlock);
+	const PxU32 flags = data.classFlags[filterData0.word3 % MAX_CLASSES] | data.classFlags[filterData1.word3 % MAX_CLASSES];
+
+	if (flags & CONTACT_REPORT_TOUCH)
+	{
+		pairFlags |= PxPairFlag::eNOTIFY_TOUCH_FOUND | PxPairFlag::eNOTIFY_TOUCH_LOST;
+	}
+
+	if (flags & CONTACT_REPORT_PERSISTS)
+	{
+		pairFlags |= PxPairFlag::eNOTIFY_TOUCH_PERSISTS;
+	}
+
+	if (flags & CONTACT_REPORT_FORCE_THRESHOLD)
+	{
+		pairFlags |= PxPairFlag::eNOTIFY_THRESHOLD_FORCE_FOUND
+			| PxPairFlag::eNOTIFY_THRESHOLD_FORCE_PERSISTS
+			| PxPairFlag::eNOTIFY_THRESHOLD_FORCE_LOST;
+	}
+
+	// Ʈ ̺Ʈ    ʿ .
+	if ((flags & CONTACT_REPORT_CONTACT_POINTS) && (flags & ~CONTACT_REPORT_CONTACT_POINTS))
+	{
+		pairFlags |= PxPairFlag::eNOTIFY_CONTACT_POINTS;
+	}
+
+	return PxFilterFlag::eDEFAULT;
+}
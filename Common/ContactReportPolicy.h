@@ -0,0 +1,71 @@
+#pragma once
+
+#include <PxPhysicsAPI.h>
+
+/*
+	PxFilterData  ϴ  Ʈ å.
+
+	 ùķ̼   word3  Ʈ Ŭ(0 ~ MAX_CLASSES-1) ְ,
+	Ŭ  ̺Ʈ  Ѵ.   Ŭ  ϳ ûϸ ƮѴ.
+	(word0 ~ word2  浹 ׷  ٸ 뵵 ܵд.)
+
+	- CONTACT_REPORT_TOUCH			:  /
+	- CONTACT_REPORT_PERSISTS		:   ( )
+	- CONTACT_REPORT_FORCE_THRESHOLD	: ˷  contactReportThreshold    //
+									  SetForceThreshold() Ϳ Ӱ谪 ؾ Ѵ.
+	- CONTACT_REPORT_CONTACT_POINTS	:  ̺Ʈ    ´.
+
+	 ̺Ʈ ִ  SetPersistInterval(n) n ӿ   óϰ   ִ.
+	̴ ̹   ÷׸ Ӹ ٲ  Ƿ   ݹ (ShouldProcess) Ѵ.
+	 óϴ  ٸ Ƿ  ӿ  ʴ´.
+*/
+
+enum ContactReportFlag : physx::PxU32
+{
+	CONTACT_REPORT_NONE				= 0,
+	CONTACT_REPORT_TOUCH			= 1 << 0,
+	CONTACT_REPORT_PERSISTS			= 1 << 1,
+	CONTACT_REPORT_FORCE_THRESHOLD	= 1 << 2,
+	CONTACT_REPORT_CONTACT_POINTS	= 1 << 3,
+};
+
+class ContactReportPolicy
+{
+public:
+	static const physx::PxU32 MAX_CLASSES = 16;
+
+	//  ̴ Ǿ Ѿ .
+	struct ShaderData
+	{
+		physx::PxU32 classFlags[MAX_CLASSES];
+	};
+
+public:
+	ContactReportPolicy();
+
+	void SetClassFlags(physx::PxU32 reportClass, physx::PxU32 flags);
+	void SetPersistInterval(physx::PxU32 frames) { m_PersistInterval = frames ? frames : 1; }
+
+	// sceneDesc   ̴ ̴ ͸ Ѵ. createScene  ȣ.
+	void ApplyTo(physx::PxSceneDesc& sceneDesc) const;
+
+	//   simulate  ȣ.
+	void NewFrame() { m_Frame++; }
+
+	// onContact   ȣ.  ݹ鿡 ȣǾ ϴ.
+	bool ShouldProcess(const physx::PxContactPair& pair) const;
+
+	static void SetShapeClass(physx::PxShape& shape, physx::PxU32 reportClass);
+	static void SetActorClass(physx::PxRigidActor& actor, physx::PxU32 reportClass);
+	static void SetForceThreshold(physx::PxRigidDynamic& actor, physx::PxReal threshold) { actor.setContactReportThreshold(threshold); }
+
+	static physx::PxFilterFlags FilterShader(
+		physx::PxFilterObjectAttributes attributes0, physx::PxFilterData filterData0,
+		physx::PxFilterObjectAttributes attributes1, physx::PxFilterData filterData1,
+		physx::PxPairFlags& pairFlags, const void* constantBlock, physx::PxU32 constantBlockSize);
+
+private:
+	ShaderData		m_Data;
+	physx::PxU32	m_PersistInterval;
+	physx::PxU32	m_Frame;
+};
@@ -0,0 +1,100 @@
+#include "OriginShiftManager.h"
+
+#include <algorithm>
+
+#include "SnippetUtils.h"
+
+using namespace physx;
+
+OriginShiftManager::Desc::Desc()
+	: threshold(500.0f)
+	, gridSize(100.0f)
+{
+}
+
+OriginShiftManager::OriginShiftManager()
+	: m_Scene(nullptr)
+	, m_Origin(0.0f)
+	, m_NbShifts(0)
+	, m_LastSceneMs(0.0f)
+	, m_LastListenerMs(0.0f)
+	, m_TotalMs(0.0f)
+{
+}
+
+void OriginShiftManager::Init(PxScene& scene, const Desc& desc)
+{
+	PX_ASSERT(desc.threshold > 0.0f && desc.gridSize > 0.0f);
+
+	m_Scene = &scene;
+	m_Desc = desc;
+	m_Origin = PxVec3(0.0f);
+	m_NbShifts = 0;
+	m_LastSceneMs = 0.0f;
+	m_LastListenerMs = 0.0f;
+	m_TotalMs = 0.0f;
+}
+
+void OriginShiftManager::Release()
+{
+	m_Scene = nullptr;
+	m_Listeners.clear();
+}
+
+void OriginShiftManager::AddListener(OriginShiftListener* listener)
+{
+	if (std::find(m_Listeners.begin(), m_Listeners.end(), listener) == m_Listeners.end())
+	{
+		m_Listeners.push_back(listener);
+	}
+}
+
+void OriginShiftManager::RemoveListener(OriginShiftListener* listener)
+{
+	m_Listeners.erase(std::remove(m_Listeners.begin(), m_Listeners.end(), listener), m_Listeners.end());
+}
+
+bool OriginShiftManager::Update(const PxVec3& focus)
+{
+	if (!m_Scene || focus.abs().maxElement() < m_Desc.threshold)
+	{
+		return false;
+	}
+
+	// ڿ 缭 Űܾ   ݿø   ʴ´.
+	const PxReal grid = m_Desc.gridSize;
+	const PxVec3 shift(PxFloor(focus.x / grid + 0.5f) * grid,
+		PxFloor(focus.y / grid + 0.5f) * grid,
+		PxFloor(focus.z / grid + 0.5f) * grid);
+
+	if (shift.isZero())
+	{
+		return false;
+	}
+
+	Shift(shift);
+	return true;
+}
+
+void OriginShiftManager::Shift(const PxVec3& shift)
+{
+	PX_ASSERT(m_Scene);
+
+	const PxU64 sceneStart = SnippetUtils::getCurrentTimeCounterValue();
+	m_Scene->shiftOrigin(shift);
+	const PxU64 listenerStart = SnippetUtils::getCurrentTimeCounterValue();
+
+	for (auto& it : m_Listeners)
+	{
+		it->OnOriginShift(shift);
+	}
+
+	const PxU64 end = SnippetUtils::getCurrentTimeCounterValue();
+
+	m_LastSceneMs = SnippetUtils::getElapsedTimeInMilliseconds(listenerStart - sceneStart);
+	m_LastListenerMs = SnippetUtils::getElapsedTimeInMilliseconds(end - listenerStart);
+	m_TotalMs += m_LastSceneMs + m_LastListenerMs;
+
+	m_Origin += shift;
+	m_NbShifts++;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+
+/*
+	 忡 float е Ű   ̵(origin shift) .
+
+	(ī޶, ÷̾ )  threshold ̻ ־ PxScene::shiftOrigin  ȣ
+	 ó  . ̵ gridSize  ߱   (GetOrigin)   ȴ.
+
+	  , MBP , Ŀ Ʈ(PxConstraintConnector::onOriginShift) PhysX Űش.
+	 ۿ   ִ ġ( ĳ, ī޶, BroadPhaseRegionManager  ٿ 纻 )
+	OriginShiftListener  ؼ  ű.
+
+	PxScene::shiftOrigin  ùķ̼ ߿ θ  Ƿ Update() fetchResults Ŀ ȣѴ.
+*/
+
+class OriginShiftListener
+{
+public:
+	virtual ~OriginShiftListener() = default;
+
+	//  ǥ =  ǥ - shift
+	virtual void OnOriginShift(const physx::PxVec3& shift) = 0;
+};
+
+class OriginShiftManager
+{
+public:
+	struct Desc
+	{
+		Desc();
+
+		physx::PxReal	threshold;	//   ̸ŭ ־ ̵
+		physx::PxReal	gridSize;	// ̵   ũ
+	};
+
+public:
+	OriginShiftManager();
+	~OriginShiftManager() = default;
+
+	void Init(physx::PxScene& scene, const Desc& desc = Desc());
+	void Release();
+
+	void AddListener(OriginShiftListener* listener);
+	void RemoveListener(OriginShiftListener* listener);
+
+	// focus    ǥ.  Ű true.
+	bool Update(const physx::PxVec3& focus);
+	void Shift(const physx::PxVec3& shift);
+
+	//  ǥ <->  ̵   ǥ
+	physx::PxVec3 ToWorld(const physx::PxVec3& local) const { return local + m_Origin; }
+	physx::PxVec3 ToLocal(const physx::PxVec3& world) const { return world - m_Origin; }
+
+	const physx::PxVec3&	GetOrigin() const { return m_Origin; }
+	physx::PxU32			GetNbShifts() const { return m_NbShifts; }
+	physx::PxReal			GetLastSceneMilliseconds() const { return m_LastSceneMs; }		// shiftOrigin ð
+	physx::PxReal			GetLastListenerMilliseconds() const { return m_LastListenerMs; }	//  ü ð
+	physx::PxReal			GetTotalMilliseconds() const { return m_TotalMs; }
+
+private:
+	physx::PxScene*						m_Scene;
+	Desc								m_Desc;
+	std::vector<OriginShiftListener*>	m_Listeners;
+
+	physx::PxVec3						m_Origin;
+	physx::PxU32						m_NbShifts;
+	physx::PxReal						m_LastSceneMs;
+	physx::PxReal						m_LastListenerMs;
+	physx::PxReal						m_TotalMs;
+};
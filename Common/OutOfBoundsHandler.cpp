@@ -0,0 +1,297 @@
+#include "OutOfBoundsHandler.h"
+
+#include "BroadPhaseRegionManager.h"
+
+using namespace physx;
+
+OutOfBoundsHandler::OutOfBoundsHandler()
+	: m_RegionManager(nullptr)
+	, m_NbProcessed(0)
+{
+	for (auto& it : m_Policies)
+	{
+		it = OutOfBoundsPolicy::eRELEASE;
+	}
+
+	m_WorldBounds.setEmpty();
+}
+
+void OutOfBoundsHandler::SetPolicy(PxU32 tag, OutOfBoundsPolicy policy)
+{
+	PX_ASSERT(tag < MAX_TAGS);
+	m_Policies[tag] = policy;
+}
+
+PxU32 OutOfBoundsHandler::GetActorTag(const PxActor& actor) const
+{
+	auto it = m_Tags.find(&actor);
+	return it != m_Tags.end() ? it->second : 0;
+}
+
+void OutOfBoundsHandler::onObjectOutOfBounds(PxShape& shape, PxActor& actor)
+{
+	//   Ƿ  Ͱ     ִ.
+	if (m_OutActorSet.insert(&actor).second)
+	{
+		m_OutActors.push_back(&actor);
+		m_OutShapes.push_back(&shape);
+	}
+}
+
+void OutOfBoundsHandler::onObjectOutOfBounds(PxAggregate& aggregate)
+{
+	if (m_OutAggregateSet.insert(&aggregate).second)
+	{
+		m_OutAggregates.push_back(&aggregate);
+	}
+}
+
+void OutOfBoundsHandler::OnOriginShift(const PxVec3& shift)
+{
+	if (!m_WorldBounds.isEmpty())
+	{
+		m_WorldBounds.minimum -= shift;
+		m_WorldBounds.maximum -= shift;
+	}
+}
+
+void OutOfBoundsHandler::Process(PxScene& scene)
+{
+	if (m_OutActors.size())
+	{
+		ProcessActors(scene);
+	}
+
+	if (m_OutAggregates.size())
+	{
+		ProcessAggregates(scene);
+	}
+}
+
+PxRigidActor* OutOfBoundsHandler::AcquireFromPool(PxU32 tag)
+{
+	std::vector<PxRigidActor*>& pool = m_Pools[tag < MAX_TAGS ? tag : 0];
+
+	if (pool.empty())
+	{
+		return nullptr;
+	}
+
+	PxRigidActor* actor = pool.back();
+	pool.pop_back();
+
+	return actor;
+}
+
+PxAggregate* OutOfBoundsHandler::AcquireAggregateFromPool()
+{
+	if (m_AggregatePool.empty())
+	{
+		return nullptr;
+	}
+
+	PxAggregate* aggregate = m_AggregatePool.back();
+	m_AggregatePool.pop_back();
+
+	return aggregate;
+}
+
+void OutOfBoundsHandler::Release()
+{
+	for (auto& pool : m_Pools)
+	{
+		for (auto& it : pool)
+		{
+			ReleaseActor(*it);
+		}
+
+		pool.clear();
+	}
+
+	for (auto& it : m_AggregatePool)
+	{
+		ReleaseAggregate(*it);
+	}
+
+	m_AggregatePool.clear();
+
+	m_OutActorSet.clear();
+	m_OutActors.clear();
+	m_OutShapes.clear();
+	m_OutAggregateSet.clear();
+	m_OutAggregates.clear();
+}
+
+//////////////////////////////////////////
+
+void OutOfBoundsHandler::ProcessActors(PxScene& scene)
+{
+	m_RemoveBuffer.clear();
+
+	const PxU32 nbOut = PxU32(m_OutActors.size());
+
+	for (PxU32 i = 0; i < nbOut; i++)
+	{
+		PxActor* actor = m_OutActors[i];
+
+		switch (GetPolicy(GetActorTag(*actor)))
+		{
+		case OutOfBoundsPolicy::eRELEASE:
+		case OutOfBoundsPolicy::eRECYCLE:
+			m_RemoveBuffer.push_back(actor);
+			break;
+		case OutOfBoundsPolicy::eTELEPORT_BACK:
+			if (actor->is<PxRigidActor>())
+			{
+				TeleportBack(*actor->is<PxRigidActor>());
+			}
+			break;
+		case OutOfBoundsPolicy::eSWITCH_REGION:
+			if (m_RegionManager)
+			{
+				m_RegionManager->OnObjectOutOfBounds(*m_OutShapes[i], *actor);
+			}
+			break;
+		case OutOfBoundsPolicy::eIGNORE:
+			break;
+		}
+	}
+
+	// ͸ ϳ release ϸ Ź     
+	// removeActors      Ѵ.
+	if (m_RemoveBuffer.size())
+	{
+		scene.removeActors(&m_RemoveBuffer[0], PxU32(m_RemoveBuffer.size()), false);
+
+		for (auto& it : m_RemoveBuffer)
+		{
+			const PxU32 tag = GetActorTag(*it);
+
+			if (GetPolicy(tag) == OutOfBoundsPolicy::eRECYCLE && it->is<PxRigidActor>())
+			{
+				m_Pools[tag < MAX_TAGS ? tag : 0].push_back(it->is<PxRigidActor>());
+			}
+			else
+			{
+				ReleaseActor(*it);
+			}
+		}
+	}
+
+	m_NbProcessed += nbOut;
+
+	m_OutActorSet.clear();
+	m_OutActors.clear();
+	m_OutShapes.clear();
+}
+
+void OutOfBoundsHandler::ProcessAggregates(PxScene& scene)
+{
+	PxActor* actors[64];
+
+	for (auto& aggregate : m_OutAggregates)
+	{
+		const PxU32 nbActors = aggregate->getNbActors();
+
+		if (!nbActors)
+		{
+			continue;
+		}
+
+		// ֱ׸Ʈ ù°  ±׸ .
+		aggregate->getActors(actors, 1, 0);
+		const OutOfBoundsPolicy policy = GetPolicy(GetActorTag(*actors[0]));
+
+		switch (policy)
+		{
+		case OutOfBoundsPolicy::eRELEASE:
+			// ֱ׸Ʈ ص  ͵  Ƿ  Ѵ.
+			scene.removeAggregate(*aggregate, false);
+			ReleaseAggregate(*aggregate);
+			break;
+		case OutOfBoundsPolicy::eRECYCLE:
+			scene.removeAggregate(*aggregate, false);
+			m_AggregatePool.push_back(aggregate);
+			break;
+		case OutOfBoundsPolicy::eTELEPORT_BACK:
+			for (PxU32 i = 0; i < nbActors; i += 64)
+			{
+				const PxU32 nbRead = aggregate->getActors(actors, 64, i);
+
+				for (PxU32 j = 0; j < nbRead; j++)
+				{
+					if (actors[j]->is<PxRigidActor>())
+					{
+						TeleportBack(*actors[j]->is<PxRigidActor>());
+					}
+				}
+			}
+			break;
+		case OutOfBoundsPolicy::eSWITCH_REGION:
+			if (m_RegionManager)
+			{
+				m_RegionManager->OnObjectOutOfBounds(*aggregate);
+			}
+			break;
+		case OutOfBoundsPolicy::eIGNORE:
+			break;
+		}
+	}
+
+	m_NbProcessed += PxU32(m_OutAggregates.size());
+
+	m_OutAggregateSet.clear();
+	m_OutAggregates.clear();
+}
+
+void OutOfBoundsHandler::ReleaseAggregate(PxAggregate& aggregate)
+{
+	PxActor* actors[64];
+
+	// ͸ ϸ ֱ׸Ʈ Ƿ  տ ٽ д´.
+	while (const PxU32 nbRead = aggregate.getActors(actors, 64, 0))
+	{
+		for (PxU32 j = 0; j < nbRead; j++)
+		{
+			ReleaseActor(*actors[j]);
+		}
+	}
+
+	aggregate.release();
+}
+
+void OutOfBoundsHandler::ReleaseActor(PxActor& actor)
+{
+	m_Tags.erase(&actor);
+	actor.release();
+}
+
+void OutOfBoundsHandler::TeleportBack(PxRigidActor& actor)
+{
+	if (m_WorldBounds.isEmpty())
+	{
+		return;
+	}
+
+	//  ٿ ü  ٿ ȿ  ߽ ű.
+	const PxBounds3 actorBounds = actor.getWorldBounds();
+	const PxVec3 extents = actorBounds.getExtents();
+	const PxVec3 center = m_WorldBounds.getCenter();
+
+	const PxVec3 minimum = (m_WorldBounds.minimum + extents).minimum(center);
+	const PxVec3 maximum = (m_WorldBounds.maximum - extents).maximum(center);
+
+	PxTransform pose = actor.getGlobalPose();
+	const PxVec3 offset = pose.p - actorBounds.getCenter();
+	pose.p = actorBounds.getCenter().maximum(minimum).minimum(maximum) + offset;
+
+	actor.setGlobalPose(pose);
+
+	PxRigidDynamic* dynamic = actor.is<PxRigidDynamic>();
+
+	if (dynamic && !(dynamic->getRigidBodyFlags() & PxRigidBodyFlag::eKINEMATIC))
+	{
+		dynamic->setLinearVelocity(PxVec3(0.0f));
+		dynamic->setAngularVelocity(PxVec3(0.0f));
+	}
+}
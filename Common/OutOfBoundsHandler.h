@@ -0,0 +1,104 @@
+#pragma once
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+
+#include "OriginShiftManager.h"
+
+class BroadPhaseRegionManager;
+
+/*
+	ε    Ʈ ó.
+
+	onObjectOutOfBounds   ȣǹǷ  Ͱ     ִ.
+	ؽü ߺ O(1) ɷ Ƶΰ, fetchResults  Process()
+	 ±׺  å    óѴ.
+
+	±״ ó   -> ± ʿ Ѵ. (SetActorTag / GetActorTag)
+	userData  ٸ ý(TriggerSystem ) Ƿ ǵ帮 ʴ´.
+	±׸  ͸     ClearActorTag  ҷ  ּ  Ͱ ±׸  ʴ´.
+	óⰡ ϴ ʹ ˾Ƽ .
+
+	 ̵   OriginShiftManager  ʷ ؾ  ٿ(eTELEPORT_BACK  ǥ)  Ű.
+*/
+
+enum class OutOfBoundsPolicy
+{
+	eIGNORE,		// ƹ͵  ʴ´.
+	eRELEASE,		//    (removeActors)  Ѵ.
+	eRECYCLE,		//  ϰ Ǯ Ѵ. AcquireFromPool() ٽ  .
+	eTELEPORT_BACK,	//  ٿ  ǵ ӵ ش.
+	eSWITCH_REGION,	// BroadPhaseRegionManager  Ѱܼ   Ѵ.
+};
+
+class OutOfBoundsHandler : public physx::PxBroadPhaseCallback, public OriginShiftListener
+{
+public:
+	static const physx::PxU32 MAX_TAGS = 16;
+
+	OutOfBoundsHandler();
+	virtual ~OutOfBoundsHandler() = default;
+
+	void SetPolicy(physx::PxU32 tag, OutOfBoundsPolicy policy);
+	OutOfBoundsPolicy GetPolicy(physx::PxU32 tag) const { return m_Policies[tag < MAX_TAGS ? tag : 0]; }
+
+	// ±װ  ʹ 0.
+	void			SetActorTag(const physx::PxActor& actor, physx::PxU32 tag) { m_Tags[&actor] = tag; }
+	physx::PxU32	GetActorTag(const physx::PxActor& actor) const;
+	void			ClearActorTag(const physx::PxActor& actor) { m_Tags.erase(&actor); }
+
+	// eTELEPORT_BACK  ǵ  ٿ.
+	void SetWorldBounds(const physx::PxBounds3& bounds) { m_WorldBounds = bounds; }
+
+	// eSWITCH_REGION    .
+	void SetRegionManager(BroadPhaseRegionManager* manager) { m_RegionManager = manager; }
+
+	// fetchResults  ȣ. Ƶ Ϳ ֱ׸Ʈ å óѴ.
+	void Process(physx::PxScene& scene);
+
+	// eRECYCLE   ͸ ϳ .  nullptr.
+	//  ʹ   Ƿ ڼ   addActor ؾѴ.
+	physx::PxRigidActor* AcquireFromPool(physx::PxU32 tag);
+	physx::PxAggregate* AcquireAggregateFromPool();
+
+	// Ǯ  ͵ Ѵ.    ȣ.
+	void Release();
+
+	physx::PxU32 GetNbProcessed() const { return m_NbProcessed; }
+
+public: // PxBroadPhaseCallback
+	virtual	void onObjectOutOfBounds(physx::PxShape& shape, physx::PxActor& actor) override;
+	virtual	void onObjectOutOfBounds(physx::PxAggregate& aggregate) override;
+
+public: // OriginShiftListener
+	virtual void OnOriginShift(const physx::PxVec3& shift) override;
+
+private:
+	void ProcessActors(physx::PxScene& scene);
+	void ProcessAggregates(physx::PxScene& scene);
+	void TeleportBack(physx::PxRigidActor& actor);
+	void ReleaseAggregate(physx::PxAggregate& aggregate);
+	void ReleaseActor(physx::PxActor& actor);
+
+private:
+	OutOfBoundsPolicy			m_Policies[MAX_TAGS];
+	std::unordered_map<const physx::PxActor*, physx::PxU32>	m_Tags;
+	physx::PxBounds3			m_WorldBounds;
+	BroadPhaseRegionManager*	m_RegionManager;
+
+	std::unordered_set<physx::PxActor*>		m_OutActorSet;		// ߺ ˻
+	std::vector<physx::PxActor*>			m_OutActors;		//   
+	std::vector<physx::PxShape*>			m_OutShapes;		// m_OutActors   ε, eSWITCH_REGION 
+
+	std::unordered_set<physx::PxAggregate*>	m_OutAggregateSet;
+	std::vector<physx::PxAggregate*>		m_OutAggregates;
+
+	std::vector<physx::PxActor*>			m_RemoveBuffer;
+	std::vector<physx::PxRigidActor*>		m_Pools[MAX_TAGS];
+	std::vector<physx::PxAggregate*>		m_AggregatePool;
+
+	physx::PxU32	m_NbProcessed;
+};
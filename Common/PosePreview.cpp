@@ -0,0 +1,139 @@
+#include "PosePreview.h"
+
+#include <thread>
+
+using namespace physx;
+
+PosePreview::PosePreview()
+	: m_WriteIndex(0)
+	, m_Middle(1)
+	, m_ReadIndex(2)
+	, m_NbBodies(0)
+	, m_Step(0)
+{
+	for (auto& it : m_Frames)
+	{
+		it.step = 0;
+		it.nbBodies = 0;
+	}
+
+	m_Pending.step = 0;
+	m_Pending.nbBodies = 0;
+}
+
+bool PosePreview::Track(PxRigidBody& body)
+{
+	for (PxU32 i = 0; i < m_NbBodies; i++)
+	{
+		if (m_Bodies[i] == &body)
+		{
+			return true;
+		}
+	}
+
+	if (m_NbBodies == MAX_BODIES)
+	{
+		return false;
+	}
+
+	m_Bodies[m_NbBodies++] = &body;
+	body.setRigidBodyFlag(PxRigidBodyFlag::eENABLE_POSE_INTEGRATION_PREVIEW, true);
+	return true;
+}
+
+void PosePreview::Untrack(PxRigidBody& body)
+{
+	for (PxU32 i = 0; i < m_NbBodies; i++)
+	{
+		if (m_Bodies[i] == &body)
+		{
+			m_Bodies[i] = m_Bodies[--m_NbBodies];
+			body.setRigidBodyFlag(PxRigidBodyFlag::eENABLE_POSE_INTEGRATION_PREVIEW, false);
+			return;
+		}
+	}
+}
+
+void PosePreview::Clear()
+{
+	// ٵ ̹ Ǿ  Ƿ ÷״ ǵ帮 ʴ´.
+	m_NbBodies = 0;
+}
+
+void PosePreview::OnAdvance(const PxRigidBody* const* bodies, const PxTransform* poses, PxU32 count)
+{
+	const PxU32 step = m_Step;
+
+	//  ĭ   ٲǷ,  ܰ ռ ȣ     纻 Ƶд.
+	if (m_Pending.step != step)
+	{
+		m_Pending.step = step;
+		m_Pending.nbBodies = 0;
+	}
+
+	for (PxU32 i = 0; i < count && m_Pending.nbBodies < MAX_BODIES; i++)
+	{
+		m_Pending.bodies[m_Pending.nbBodies] = bodies[i];
+		m_Pending.poses[m_Pending.nbBodies] = poses[i];
+		m_Pending.nbBodies++;
+	}
+
+	Frame& frame = m_Frames[m_WriteIndex];
+	frame.step = step;
+	frame.nbBodies = m_Pending.nbBodies;
+	PxMemCopy(frame.bodies, m_Pending.bodies, sizeof(frame.bodies[0]) * frame.nbBodies);
+	PxMemCopy(frame.poses, m_Pending.poses, sizeof(frame.poses[0]) * frame.nbBodies);
+
+	m_WriteIndex = m_Middle.exchange(m_WriteIndex | FRESH) & 3;
+}
+
+bool PosePreview::Acquire()
+{
+	if (!(m_Middle.load() & FRESH))
+	{
+		return false;
+	}
+
+	m_ReadIndex = m_Middle.exchange(m_ReadIndex) & 3;
+	return true;
+}
+
+bool PosePreview::WaitForStep(PxScene& scene)
+{
+	const PxU32 step = m_Step;
+
+	for (;;)
+	{
+		Acquire();
+
+		if (GetAcquiredStep() == step)
+		{
+			return true;
+		}
+
+		if (scene.checkResults(false))
+		{
+			// ùķ̼  ̿   Ƿ    .
+			Acquire();
+			return GetAcquiredStep() == step;
+		}
+
+		std::this_thread::yield();
+	}
+}
+
+bool PosePreview::GetPose(const PxRigidBody& body, PxTransform& pose) const
+{
+	const Frame& frame = m_Frames[m_ReadIndex];
+
+	for (PxU32 i = 0; i < frame.nbBodies; i++)
+	{
+		if (frame.bodies[i] == &body)
+		{
+			pose = frame.poses[i];
+			return true;
+		}
+	}
+
+	return false;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+
+#include <PxPhysicsAPI.h>
+
+/*
+	onAdvance  Ϻ ٵ(÷̾, ī޶  )   fetchResults  ޾ƿ .
+
+	Track() ٵ eENABLE_POSE_INTEGRATION_PREVIEW  Ѱ, ùķ̼  onAdvance   
+	   ۷  忡 ѱ.   ٸ ʰ, д  ׻  ֱٿ ϼ  .
+
+	onAdvance   ܰ迡   Ҹ  Ƿ  ܰ  ļ .
+	(ÿ  忡 Ҹ ʴ´ٰ Ѵ.)
+
+	
+		simulate 	: preview.BeginStep();
+		onAdvance		: preview.OnAdvance(bodies, poses, count);
+		simulate 	: if (preview.WaitForStep(*scene) && preview.GetPose(body, pose)) ... / 
+		 			: scene->fetchResults(true);
+*/
+
+class PosePreview
+{
+public:
+	static const physx::PxU32 MAX_BODIES = 64;
+
+public:
+	PosePreview();
+
+	// simulate ۿ ȣ.     false.
+	bool Track(physx::PxRigidBody& body);
+	void Untrack(physx::PxRigidBody& body);
+	void Clear();
+
+	void BeginStep() { m_Step++; }
+
+	// PxSimulationEventCallback::onAdvance  ȣ.
+	void OnAdvance(const physx::PxRigidBody* const* bodies, const physx::PxTransform* poses, physx::PxU32 count);
+
+	//  ϼ   װ ٲٰ true.
+	bool Acquire();
+
+	// ̹ ܰ    纸ϸ ٸ.
+	//   ٵ    onAdvance   Ƿ ùķ̼  false  ƿ´.
+	bool WaitForStep(physx::PxScene& scene);
+
+	// Acquire  ӿ ã´.
+	bool GetPose(const physx::PxRigidBody& body, physx::PxTransform& pose) const;
+
+	physx::PxU32 GetAcquiredStep() const { return m_Frames[m_ReadIndex].step; }
+	physx::PxU32 GetCurrentStep() const { return m_Step; }
+
+private:
+	struct Frame
+	{
+		physx::PxU32				step;
+		physx::PxU32				nbBodies;
+		const physx::PxRigidBody*	bodies[MAX_BODIES];
+		physx::PxTransform			poses[MAX_BODIES];
+	};
+
+	// m_Middle   Ʈ  д     ̴.
+	static const physx::PxU32 FRESH = 4;
+
+private:
+	Frame						m_Frames[3];
+	Frame						m_Pending;		// onAdvance . ̹ ܰ迡   .
+	physx::PxU32				m_WriteIndex;	// onAdvance 
+	std::atomic<physx::PxU32>	m_Middle;
+	physx::PxU32				m_ReadIndex;	//   
+
+	const physx::PxRigidBody*	m_Bodies[MAX_BODIES];
+	physx::PxU32				m_NbBodies;
+	std::atomic<physx::PxU32>	m_Step;
+};
@@ -0,0 +1,101 @@
+#include "ProfileZoneTimer.h"
+
+#include <string.h>
+
+#include "SnippetUtils.h"
+
+using namespace physx;
+
+namespace
+{
+	// 庰  ø .  ٱ  ð .
+	thread_local PxU32 tZoneDepth[ProfileZoneTimer::MAX_ZONES];
+}
+
+ProfileZoneTimer::ProfileZoneTimer()
+	: m_NbNames(0)
+	, m_NbZones(0)
+{
+	for (PxU32 i = 0; i < MAX_NAMES; i++)
+	{
+		m_Names[i] = nullptr;
+		m_NameZones[i] = 0;
+	}
+
+	Reset();
+}
+
+PxU32 ProfileZoneTimer::AddZone(const char* const* names, PxU32 nbNames)
+{
+	PX_ASSERT(m_NbZones < MAX_ZONES);
+	PX_ASSERT(m_NbNames + nbNames <= MAX_NAMES);
+
+	for (PxU32 i = 0; i < nbNames; i++)
+	{
+		m_Names[m_NbNames] = names[i];
+		m_NameZones[m_NbNames] = m_NbZones;
+		m_NbNames++;
+	}
+
+	return m_NbZones++;
+}
+
+void ProfileZoneTimer::Reset()
+{
+	for (PxU32 i = 0; i < MAX_ZONES; i++)
+	{
+		m_Ticks[i] = 0;
+		m_Calls[i] = 0;
+	}
+}
+
+PxReal ProfileZoneTimer::GetMilliseconds(PxU32 zoneIndex) const
+{
+	return SnippetUtils::getElapsedTimeInMilliseconds(m_Ticks[zoneIndex].load());
+}
+
+PxU32 ProfileZoneTimer::GetNbCalls(PxU32 zoneIndex) const
+{
+	return m_Calls[zoneIndex].load();
+}
+
+void* ProfileZoneTimer::zoneStart(const char* eventName, bool detached, uint64_t)
+{
+	// ٸ 忡    ð Ѱ  Ƿ .
+	const PxI32 index = detached ? -1 : FindZone(eventName);
+
+	if (index < 0 || tZoneDepth[index]++)
+	{
+		return nullptr;
+	}
+
+	return reinterpret_cast<void*>(size_t(SnippetUtils::getCurrentTimeCounterValue()));
+}
+
+void ProfileZoneTimer::zoneEnd(void* profilerData, const char* eventName, bool detached, uint64_t)
+{
+	const PxI32 index = detached ? -1 : FindZone(eventName);
+
+	if (index < 0 || --tZoneDepth[index] || !profilerData)
+	{
+		return;
+	}
+
+	const PxU64 start = PxU64(reinterpret_cast<size_t>(profilerData));
+
+	m_Ticks[index].fetch_add(SnippetUtils::getCurrentTimeCounterValue() - start, std::memory_order_relaxed);
+	m_Calls[index].fetch_add(1, std::memory_order_relaxed);
+}
+
+PxI32 ProfileZoneTimer::FindZone(const char* eventName) const
+{
+	for (PxU32 i = 0; i < m_NbNames; i++)
+	{
+		if (!strcmp(eventName, m_Names[i]))
+		{
+			return PxI32(m_NameZones[i]);
+		}
+	}
+
+	return -1;
+}
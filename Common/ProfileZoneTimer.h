@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+
+/*
+	PhysX   (zone) ð  PxProfilerCallback.
+
+	AddZone()  ̸ Ȯ  ̸  ð Ѵ.  ̸     ִ.
+	     忡 øǸ  ٱ  .
+	ð    ð  CPU ð̴. Ŀ 忡 ÿ   ð ð ũ ´.
+	 ̺Ʈ PhysX   ؼ  (debug, checked, profile) ߻Ѵ.
+
+	
+		const char* names[] = { "BroadPhase.SapUpdate", "BroadPhase.SapPostUpdate" };
+		gZoneTimer.AddZone(names, 2);
+		PxSetProfilerCallback(&gZoneTimer);		// PVD  PVD Ϸ ڸ ϹǷ   ʴ´.
+		...
+		gZoneTimer.GetMilliseconds(0);
+*/
+
+class ProfileZoneTimer : public physx::PxProfilerCallback
+{
+public:
+	static const physx::PxU32 MAX_ZONES = 8;
+	static const physx::PxU32 MAX_NAMES = 16;
+
+	ProfileZoneTimer();
+	virtual ~ProfileZoneTimer() = default;
+
+	// ȯ GetMilliseconds  ѱ ε. ̸ ڿ Ÿ̸Ӻ   ־ Ѵ.
+	physx::PxU32 AddZone(const char* name) { return AddZone(&name, 1); }
+	physx::PxU32 AddZone(const char* const* names, physx::PxU32 nbNames);
+
+	void			Reset();
+	physx::PxReal	GetMilliseconds(physx::PxU32 zoneIndex) const;	//  ջ CPU ð
+	physx::PxU32	GetNbCalls(physx::PxU32 zoneIndex) const;
+
+public: // PxProfilerCallback
+	virtual void*	zoneStart(const char* eventName, bool detached, uint64_t contextId) override;
+	virtual void	zoneEnd(void* profilerData, const char* eventName, bool detached, uint64_t contextId) override;
+
+private:
+	physx::PxI32	FindZone(const char* eventName) const;
+
+private:
+	const char*						m_Names[MAX_NAMES];
+	physx::PxU32					m_NameZones[MAX_NAMES];
+	physx::PxU32					m_NbNames;
+	physx::PxU32					m_NbZones;
+
+	std::atomic<physx::PxU64>		m_Ticks[MAX_ZONES];
+	std::atomic<physx::PxU32>		m_Calls[MAX_ZONES];
+};
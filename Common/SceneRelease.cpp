@@ -0,0 +1,27 @@
+#include "SceneRelease.h"
+
+#include <vector>
+
+using namespace physx;
+
+void ReleaseScene(PxScene& scene)
+{
+	std::vector<PxConstraint*> constraints(scene.getNbConstraints());
+	const PxU32 nbConstraints = scene.getConstraints(constraints.data(), PxU32(constraints.size()));
+
+	for (PxU32 i = 0; i < nbConstraints; i++)
+	{
+		constraints[i]->release();
+	}
+
+	const PxActorTypeFlags types = PxActorTypeFlag::eRIGID_STATIC | PxActorTypeFlag::eRIGID_DYNAMIC;
+	std::vector<PxActor*> actors(scene.getNbActors(types));
+	const PxU32 nbActors = scene.getActors(types, actors.data(), PxU32(actors.size()));
+
+	for (PxU32 i = 0; i < nbActors; i++)
+	{
+		actors[i]->release();
+	}
+
+	scene.release();
+}
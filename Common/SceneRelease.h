@@ -0,0 +1,17 @@
+#pragma once
+
+#include <PxPhysicsAPI.h>
+
+/*
+	  ִ , /̳ ͸ Բ Ѵ.
+
+	PxScene::release  Ϳ Ʈ  ⸸ ϰ  Ƿ ġũó      .
+	PxConstraint    Ʈ(Ȯ Ʈ, PulleyJoint,  ) onConstraintRelease   .
+	÷ǿ ִ Ʈ ÷ ʿ  ϰ θ.
+
+	
+		ReleaseScene(*scene);
+		scene = nullptr;
+*/
+
+void ReleaseScene(physx::PxScene& scene);
@@ -0,0 +1,240 @@
+#include "SceneTuning.h"
+
+using namespace physx;
+
+namespace
+{
+	const PxU32 PROFILE_MAGIC = PxU32('S') | (PxU32('T') << 8) | (PxU32('U') << 16) | (PxU32('N') << 24);
+	const PxU32 PROFILE_VERSION = 1;
+
+	// Ͽ ״  . ʵ带 ٲٸ PROFILE_VERSION ø.
+	struct ProfileFileData
+	{
+		PxU32 magic;
+		PxU32 version;
+
+		PxU32 maxNbActors;
+		PxU32 maxNbBodies;
+		PxU32 maxNbStaticShapes;
+		PxU32 maxNbDynamicShapes;
+		PxU32 maxNbAggregates;
+		PxU32 maxNbConstraints;
+		PxU32 maxNbRegions;
+		PxU32 maxNbBroadPhaseOverlaps;
+
+		PxU32 nbContactDataBlocks;
+		PxU32 contactReportStreamBufferSize;
+	};
+
+	PxU32 ApplyHeadroom(PxU32 value, PxReal headroom)
+	{
+		return value ? PxU32(PxReal(value) * headroom) + 1 : 0;
+	}
+}
+
+SceneTuningProfile::SceneTuningProfile()
+	: nbContactDataBlocks(0)
+	, contactReportStreamBufferSize(8192) // PxSceneDesc ⺻
+{
+}
+
+bool SceneTuningProfile::Load(const char* path)
+{
+	PxDefaultFileInputData input(path);
+
+	if (!input.isValid() || input.getLength() != sizeof(ProfileFileData))
+	{
+		return false;
+	}
+
+	ProfileFileData data;
+	input.read(&data, sizeof(data));
+
+	if (data.magic != PROFILE_MAGIC || data.version != PROFILE_VERSION)
+	{
+		return false;
+	}
+
+	limits.maxNbActors = data.maxNbActors;
+	limits.maxNbBodies = data.maxNbBodies;
+	limits.maxNbStaticShapes = data.maxNbStaticShapes;
+	limits.maxNbDynamicShapes = data.maxNbDynamicShapes;
+	limits.maxNbAggregates = data.maxNbAggregates;
+	limits.maxNbConstraints = data.maxNbConstraints;
+	limits.maxNbRegions = data.maxNbRegions;
+	limits.maxNbBroadPhaseOverlaps = data.maxNbBroadPhaseOverlaps;
+
+	nbContactDataBlocks = data.nbContactDataBlocks;
+	contactReportStreamBufferSize = data.contactReportStreamBufferSize;
+
+	return limits.isValid() && contactReportStreamBufferSize != 0;
+}
+
+bool SceneTuningProfile::Save(const char* path) const
+{
+	PxDefaultFileOutputStream output(path);
+
+	if (!output.isValid())
+	{
+		return false;
+	}
+
+	ProfileFileData data;
+	data.magic = PROFILE_MAGIC;
+	data.version = PROFILE_VERSION;
+
+	data.maxNbActors = limits.maxNbActors;
+	data.maxNbBodies = limits.maxNbBodies;
+	data.maxNbStaticShapes = limits.maxNbStaticShapes;
+	data.maxNbDynamicShapes = limits.maxNbDynamicShapes;
+	data.maxNbAggregates = limits.maxNbAggregates;
+	data.maxNbConstraints = limits.maxNbConstraints;
+	data.maxNbRegions = limits.maxNbRegions;
+	data.maxNbBroadPhaseOverlaps = limits.maxNbBroadPhaseOverlaps;
+
+	data.nbContactDataBlocks = nbContactDataBlocks;
+	data.contactReportStreamBufferSize = contactReportStreamBufferSize;
+
+	return output.write(&data, sizeof(data)) == sizeof(data);
+}
+
+void SceneTuningProfile::ApplyTo(PxSceneDesc& sceneDesc) const
+{
+	sceneDesc.limits = limits;
+	sceneDesc.contactReportStreamBufferSize = contactReportStreamBufferSize;
+
+	// nbContactDataBlocks  maxNbContactDataBlocks  Ŭ  .
+	sceneDesc.nbContactDataBlocks = nbContactDataBlocks;
+	sceneDesc.maxNbContactDataBlocks = PxMax(sceneDesc.maxNbContactDataBlocks, nbContactDataBlocks);
+}
+
+void SceneTuningProfile::ApplyTo(PxScene& scene) const
+{
+	if (nbContactDataBlocks)
+	{
+		scene.setNbContactDataBlocks(nbContactDataBlocks);
+	}
+}
+
+//////////////////////////////////////////
+
+SceneTuningRecorder::SceneTuningRecorder()
+{
+	Reset();
+}
+
+void SceneTuningRecorder::Reset()
+{
+	m_FrameReportBytes = 0;
+
+	m_NbFrames = 0;
+	m_LastNbActors = 0xffffffff;
+
+	m_MaxNbActors = 0;
+	m_MaxNbBodies = 0;
+	m_MaxNbStaticShapes = 0;
+	m_MaxNbDynamicShapes = 0;
+	m_MaxNbAggregates = 0;
+	m_MaxNbConstraints = 0;
+	m_MaxNbRegions = 0;
+	m_MaxNbPairs = 0;
+	m_MaxNbContactDataBlocks = 0;
+	m_MaxReportBytes = 0;
+}
+
+void SceneTuningRecorder::RecordContactReport(const PxContactPair* pairs, PxU32 nbPairs)
+{
+	// Ʈ Ʈ  , PxContactPair 迭,  ġ/Ʈ/޽ .
+	PxU32 bytes = sizeof(PxContactPairHeader) + nbPairs * sizeof(PxContactPair);
+
+	for (PxU32 i = 0; i < nbPairs; i++)
+	{
+		bytes += pairs[i].requiredBufferSize;
+	}
+
+	m_FrameReportBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void SceneTuningRecorder::RecordFrame(PxScene& scene)
+{
+	PxSimulationStatistics stats;
+	scene.getSimulationStatistics(stats);
+
+	const PxU32 nbActors = scene.getNbActors(PxActorTypeFlag::eRIGID_DYNAMIC | PxActorTypeFlag::eRIGID_STATIC);
+
+	//   ͸ ȸؾ   Ƿ   ٲ ӿ .
+	if (nbActors != m_LastNbActors)
+	{
+		m_LastNbActors = nbActors;
+		CountShapes(scene);
+	}
+
+	m_MaxNbActors = PxMax(m_MaxNbActors, nbActors);
+	m_MaxNbBodies = PxMax(m_MaxNbBodies, stats.nbDynamicBodies + stats.nbKinematicBodies);
+	m_MaxNbAggregates = PxMax(m_MaxNbAggregates, scene.getNbAggregates());
+	m_MaxNbConstraints = PxMax(m_MaxNbConstraints, scene.getNbConstraints());
+	m_MaxNbRegions = PxMax(m_MaxNbRegions, scene.getNbBroadPhaseRegions());
+
+	// ε ħ      ο    Ѵ.
+	m_MaxNbPairs = PxMax(m_MaxNbPairs, stats.nbDiscreteContactPairsTotal);
+
+	m_MaxNbContactDataBlocks = PxMax(m_MaxNbContactDataBlocks, scene.getMaxNbContactDataBlocksUsed());
+	m_MaxReportBytes = PxMax(m_MaxReportBytes, m_FrameReportBytes.exchange(0, std::memory_order_relaxed));
+
+	m_NbFrames++;
+}
+
+SceneTuningProfile SceneTuningRecorder::BuildProfile(PxReal headroom) const
+{
+	SceneTuningProfile profile;
+
+	profile.limits.maxNbActors = ApplyHeadroom(m_MaxNbActors, headroom);
+	profile.limits.maxNbBodies = ApplyHeadroom(m_MaxNbBodies, headroom);
+	profile.limits.maxNbStaticShapes = ApplyHeadroom(m_MaxNbStaticShapes, headroom);
+	profile.limits.maxNbDynamicShapes = ApplyHeadroom(m_MaxNbDynamicShapes, headroom);
+	profile.limits.maxNbAggregates = ApplyHeadroom(m_MaxNbAggregates, headroom);
+	profile.limits.maxNbConstraints = ApplyHeadroom(m_MaxNbConstraints, headroom);
+	profile.limits.maxNbRegions = PxMin(ApplyHeadroom(m_MaxNbRegions, headroom), 256u);
+	profile.limits.maxNbBroadPhaseOverlaps = ApplyHeadroom(m_MaxNbPairs, headroom);
+
+	profile.nbContactDataBlocks = ApplyHeadroom(m_MaxNbContactDataBlocks, headroom);
+
+	// Ʈ ۴ ϸ 2辿 ĿǷ ⺻ ۰  ʿ .
+	profile.contactReportStreamBufferSize = PxMax(ApplyHeadroom(m_MaxReportBytes, headroom), 8192u);
+
+	return profile;
+}
+
+void SceneTuningRecorder::CountShapes(PxScene& scene)
+{
+	const PxActorTypeFlags types = PxActorTypeFlag::eRIGID_DYNAMIC | PxActorTypeFlag::eRIGID_STATIC;
+
+	m_ActorBuffer.resize(scene.getNbActors(types));
+
+	if (m_ActorBuffer.empty())
+	{
+		return;
+	}
+
+	scene.getActors(types, &m_ActorBuffer[0], PxU32(m_ActorBuffer.size()));
+
+	PxU32 nbStaticShapes = 0;
+	PxU32 nbDynamicShapes = 0;
+
+	for (auto& it : m_ActorBuffer)
+	{
+		const PxRigidActor* actor = it->is<PxRigidActor>();
+
+		if (actor->is<PxRigidStatic>())
+		{
+			nbStaticShapes += actor->getNbShapes();
+		}
+		else
+		{
+			nbDynamicShapes += actor->getNbShapes();
+		}
+	}
+
+	m_MaxNbStaticShapes = PxMax(m_MaxNbStaticShapes, nbStaticShapes);
+	m_MaxNbDynamicShapes = PxMax(m_MaxNbDynamicShapes, nbDynamicShapes);
+}
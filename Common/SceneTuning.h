@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+
+/*
+	  Ҵ Ʃ.
+
+	PxSceneDesc::limits, nbContactDataBlocks, contactReportStreamBufferSize   
+	SDK ó ſ ӵ鿡 ۸ Ű鼭  Ʀ(hitch) .
+
+	1.    SceneTuningRecorder  鼭 ִ 뷮 ϰ
+	     SceneTuningProfile Ѵ.
+	2.  ʹ createScene   PxSceneDesc ؼ
+	    ¿ ʿ ޸𸮸   ҴѴ.
+*/
+
+struct SceneTuningProfile
+{
+	physx::PxSceneLimits	limits;
+	physx::PxU32			nbContactDataBlocks;			// 16K  
+	physx::PxU32			contactReportStreamBufferSize;	// Ʈ 
+
+	SceneTuningProfile();
+
+	bool Load(const char* path);
+	bool Save(const char* path) const;
+
+	// createScene  ȣ.
+	void ApplyTo(physx::PxSceneDesc& sceneDesc) const;
+
+	// ̹    ϸ ̸ Ѵ. (limits, Ʈ ۴  Ŀ ٲ  .)
+	void ApplyTo(physx::PxScene& scene) const;
+};
+
+class SceneTuningRecorder
+{
+public:
+	SceneTuningRecorder();
+
+	void Reset();
+
+	// onContact  ȣ.  ݹ鿡 ȣǾ ϴ.
+	void RecordContactReport(const physx::PxContactPair* pairs, physx::PxU32 nbPairs);
+
+	// fetchResults    ȣ.
+	void RecordFrame(physx::PxScene& scene);
+
+	// ϵ ִ밪 (headroom)   .
+	SceneTuningProfile BuildProfile(physx::PxReal headroom = 1.25f) const;
+
+	physx::PxU32 GetNbRecordedFrames() const { return m_NbFrames; }
+
+private:
+	void CountShapes(physx::PxScene& scene);
+
+private:
+	std::atomic<physx::PxU32>	m_FrameReportBytes;
+
+	physx::PxU32	m_NbFrames;
+	physx::PxU32	m_LastNbActors;
+
+	physx::PxU32	m_MaxNbActors;
+	physx::PxU32	m_MaxNbBodies;
+	physx::PxU32	m_MaxNbStaticShapes;
+	physx::PxU32	m_MaxNbDynamicShapes;
+	physx::PxU32	m_MaxNbAggregates;
+	physx::PxU32	m_MaxNbConstraints;
+	physx::PxU32	m_MaxNbRegions;
+	physx::PxU32	m_MaxNbPairs;
+	physx::PxU32	m_MaxNbContactDataBlocks;
+	physx::PxU32	m_MaxReportBytes;
+
+	std::vector<physx::PxActor*> m_ActorBuffer;
+};
@@ -0,0 +1,99 @@
+#include "SleepTracker.h"
+
+using namespace physx;
+
+SleepTracker::SleepTracker()
+	: m_NbWakes(0)
+	, m_NbSleeps(0)
+{
+}
+
+void SleepTracker::Add(PxRigidDynamic& body)
+{
+	if (m_Slots.count(&body))
+	{
+		return;
+	}
+
+	body.setActorFlag(PxActorFlag::eSEND_SLEEP_NOTIFIES, true);
+
+	const Set set = body.isSleeping() ? ASLEEP : AWAKE;
+	Slot slot = { set, PxU32(m_Sets[set].size()) };
+
+	m_Sets[set].push_back(&body);
+	m_Slots.emplace(&body, slot);
+}
+
+void SleepTracker::Remove(PxRigidDynamic& body)
+{
+	auto it = m_Slots.find(&body);
+
+	if (it == m_Slots.end())
+	{
+		return;
+	}
+
+	body.setActorFlag(PxActorFlag::eSEND_SLEEP_NOTIFIES, false);
+
+	Erase(it->second);
+	m_Slots.erase(it);
+}
+
+void SleepTracker::Clear()
+{
+	m_Sets[AWAKE].clear();
+	m_Sets[ASLEEP].clear();
+	m_Slots.clear();
+	ResetCounters();
+}
+
+void SleepTracker::OnWake(PxActor** actors, PxU32 count)
+{
+	Move(actors, count, AWAKE);
+}
+
+void SleepTracker::OnSleep(PxActor** actors, PxU32 count)
+{
+	Move(actors, count, ASLEEP);
+}
+
+void SleepTracker::Move(PxActor** actors, PxU32 count, Set to)
+{
+	for (PxU32 i = 0; i < count; i++)
+	{
+		auto it = m_Slots.find(actors[i]);
+
+		//  ʴ ̰ų ̹  տ  Ѿ.
+		if (it == m_Slots.end() || it->second.set == to)
+		{
+			continue;
+		}
+
+		Slot& slot = it->second;
+		Erase(slot);
+
+		slot.set = to;
+		slot.position = PxU32(m_Sets[to].size());
+		m_Sets[to].push_back(static_cast<PxRigidActor*>(actors[i]));
+
+		if (to == AWAKE)
+		{
+			m_NbWakes++;
+		}
+		else
+		{
+			m_NbSleeps++;
+		}
+	}
+}
+
+void SleepTracker::Erase(Slot& slot)
+{
+	//  Ҹ ڸ ű   ġ ģ.
+	std::vector<PxRigidActor*>& set = m_Sets[slot.set];
+	PxRigidActor* last = set.back();
+
+	set[slot.position] = last;
+	m_Slots[last].position = slot.position;
+	set.pop_back();
+}
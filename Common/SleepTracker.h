@@ -0,0 +1,72 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+
+/*
+	onWake / onSleep ̺Ʈ ̳ ٵ ִ հ     ִ .
+
+	   Ϳ isSleeping()  ,  ĳ, AI, Ʈũ   GetAwake()  ȴ.
+	  ƴ 迭̰, ű   ҿ ڸ ٲٹǷ   ʴ´.
+
+	Add  ٵ PxActorFlag::eSEND_SLEEP_NOTIFIES  Ѽ ̺Ʈ ޴´.
+	̺Ʈ fetchResults ȿ   Ƿ  .
+	addActor  ٵ ̺Ʈ  ִ · ϹǷ Add    ¸ од.
+
+	
+		addActor 		: tracker.Add(*body);
+		onWake			: tracker.OnWake(actors, count);
+		onSleep			: tracker.OnSleep(actors, count);
+		fetchResults 	: for (i < tracker.GetNbAwake()) tracker.GetAwake()[i] ...
+*/
+
+class SleepTracker
+{
+public:
+	SleepTracker();
+
+	void Add(physx::PxRigidDynamic& body);
+	void Remove(physx::PxRigidDynamic& body);
+	void Clear();
+
+	// PxSimulationEventCallback::onWake / onSleep  ȣ.
+	void OnWake(physx::PxActor** actors, physx::PxU32 count);
+	void OnSleep(physx::PxActor** actors, physx::PxU32 count);
+
+	physx::PxU32				GetNbAwake() const { return physx::PxU32(m_Sets[AWAKE].size()); }
+	physx::PxRigidActor* const*	GetAwake() const { return m_Sets[AWAKE].data(); }
+	physx::PxU32				GetNbAsleep() const { return physx::PxU32(m_Sets[ASLEEP].size()); }
+	physx::PxRigidActor* const*	GetAsleep() const { return m_Sets[ASLEEP].data(); }
+
+	bool IsTracked(const physx::PxRigidDynamic& body) const { return m_Slots.count(&body) != 0; }
+
+	// ResetCounters    ű ̺Ʈ .
+	void			ResetCounters() { m_NbWakes = m_NbSleeps = 0; }
+	physx::PxU32	GetNbWakes() const { return m_NbWakes; }
+	physx::PxU32	GetNbSleeps() const { return m_NbSleeps; }
+
+private:
+	enum Set : physx::PxU32
+	{
+		AWAKE,
+		ASLEEP,
+	};
+
+	struct Slot
+	{
+		Set				set;
+		physx::PxU32	position;
+	};
+
+	void Move(physx::PxActor** actors, physx::PxU32 count, Set to);
+	void Erase(Slot& slot);
+
+private:
+	std::vector<physx::PxRigidActor*>						m_Sets[2];
+	std::unordered_map<const physx::PxActor*, Slot>	m_Slots;
+
+	physx::PxU32	m_NbWakes;
+	physx::PxU32	m_NbSleeps;
+};
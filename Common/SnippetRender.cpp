@@ -306,57 +306,68 @@ void finishRender()
 	glutSwapBuffers();
 }
 
-void renderActors(PxRigidActor** actors, const PxU32 numActors, bool shadows, const PxVec3& color)
+static void renderActor(PxRigidActor* actor, bool sleeping, bool shadows, const PxVec3& color)
 {
 	const PxVec3 shadowDir(0.0f, -0.7071067f, -0.7071067f);
 	const PxReal shadowMat[]={ 1,0,0,0, -shadowDir.x/shadowDir.y,0,-shadowDir.z/shadowDir.y,0, 0,0,1,0, 0,0,0,1 };
 
 	PxShape* shapes[MAX_NUM_ACTOR_SHAPES];
-	for(PxU32 i=0;i<numActors;i++)
+	const PxU32 nbShapes = actor->getNbShapes();
+	PX_ASSERT(nbShapes <= MAX_NUM_ACTOR_SHAPES);
+	actor->getShapes(shapes, nbShapes);
+
+	for(PxU32 j=0;j<nbShapes;j++)
 	{
-		const PxU32 nbShapes = actors[i]->getNbShapes();
-		PX_ASSERT(nbShapes <= MAX_NUM_ACTOR_SHAPES);
-		actors[i]->getShapes(shapes, nbShapes);
-		const bool sleeping = actors[i]->is<PxRigidDynamic>() ? actors[i]->is<PxRigidDynamic>()->isSleeping() : false; 
+		const PxMat44 shapePose(PxShapeExt::getGlobalPose(*shapes[j], *actor));
+		const PxGeometryHolder h = shapes[j]->getGeometry();
 
-		for(PxU32 j=0;j<nbShapes;j++)
+		if (shapes[j]->getFlags() & PxShapeFlag::eTRIGGER_SHAPE)
+			glPolygonMode( GL_FRONT_AND_BACK, GL_LINE );
+		
+		// render object
+		glPushMatrix();						
+		glMultMatrixf(&shapePose.column0.x);
+		if(sleeping)
 		{
-			const PxMat44 shapePose(PxShapeExt::getGlobalPose(*shapes[j], *actors[i]));
-			const PxGeometryHolder h = shapes[j]->getGeometry();
+			const PxVec3 darkColor = color * 0.25f;
+			glColor4f(darkColor.x, darkColor.y, darkColor.z, 1.0f);
+		}
+		else
+			glColor4f(color.x, color.y, color.z, 1.0f);
+		renderGeometryHolder(h);
+		glPopMatrix();
 
-			if (shapes[j]->getFlags() & PxShapeFlag::eTRIGGER_SHAPE)
-				glPolygonMode( GL_FRONT_AND_BACK, GL_LINE );
-			
-			// render object
+		glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
+
+		if(shadows)
+		{
 			glPushMatrix();						
+			glMultMatrixf(shadowMat);
 			glMultMatrixf(&shapePose.column0.x);
-			if(sleeping)
-			{
-				const PxVec3 darkColor = color * 0.25f;
-				glColor4f(darkColor.x, darkColor.y, darkColor.z, 1.0f);
-			}
-			else
-				glColor4f(color.x, color.y, color.z, 1.0f);
+			glDisable(GL_LIGHTING);
+			glColor4f(0.1f, 0.2f, 0.3f, 1.0f);
 			renderGeometryHolder(h);
+			glEnable(GL_LIGHTING);
 			glPopMatrix();
-
-			glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
-
-			if(shadows)
-			{
-				glPushMatrix();						
-				glMultMatrixf(shadowMat);
-				glMultMatrixf(&shapePose.column0.x);
-				glDisable(GL_LIGHTING);
-				glColor4f(0.1f, 0.2f, 0.3f, 1.0f);
-				renderGeometryHolder(h);
-				glEnable(GL_LIGHTING);
-				glPopMatrix();
-			}
 		}
 	}
 }
 
+void renderActors(PxRigidActor** actors, const PxU32 numActors, bool shadows, const PxVec3& color)
+{
+	for(PxU32 i=0;i<numActors;i++)
+	{
+		const bool sleeping = actors[i]->is<PxRigidDynamic>() ? actors[i]->is<PxRigidDynamic>()->isSleeping() : false; 
+		renderActor(actors[i], sleeping, shadows, color);
+	}
+}
+
+void renderActors(PxRigidActor* const* actors, const PxU32 numActors, bool shadows, const PxVec3& color, bool sleeping)
+{
+	for(PxU32 i=0;i<numActors;i++)
+		renderActor(actors[i], sleeping, shadows, color);
+}
+
 /*static const PxU32 gGeomSizes[] = {
 	sizeof(PxSphereGeometry),
 	sizeof(PxPlaneGeometry),
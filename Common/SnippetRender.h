@@ -55,6 +55,8 @@ namespace Snippets
 	void finishRender();
 
 	void renderActors(physx::PxRigidActor** actors, const physx::PxU32 numActors, bool shadows = false, const physx::PxVec3& color = physx::PxVec3(0.0f, 0.75f, 0.0f));
+	// Same as above, but the caller already knows the sleep state (e.g. from onWake/onSleep) so isSleeping() is not queried.
+	void renderActors(physx::PxRigidActor* const* actors, const physx::PxU32 numActors, bool shadows, const physx::PxVec3& color, bool sleeping);
 //	void renderGeoms(const physx::PxU32 nbGeoms, const physx::PxGeometry* geoms, const physx::PxTransform* poses, bool shadows, const physx::PxVec3& color);
 	void renderGeoms(const physx::PxU32 nbGeoms, const physx::PxGeometryHolder* geoms, const physx::PxTransform* poses, bool shadows, const physx::PxVec3& color);
 }
@@ -0,0 +1,128 @@
+#include "SolverTuner.h"
+
+#include "SceneRelease.h"
+#include "SnippetUtils.h"
+
+using namespace physx;
+
+SolverTuner::SolverTuner(PxPhysics& physics, PxCpuDispatcher& dispatcher, PxMaterial& material)
+	: m_Physics(physics)
+	, m_Dispatcher(dispatcher)
+	, m_Material(material)
+	, m_WarmUpFrames(30)
+	, m_MeasureFrames(180)
+{
+	const PxU32 positionIterations[] = { 1, 2, 4, 8, 16, 32 };
+	const PxU32 velocityIterations[] = { 1, 4 };
+
+	SetPositionIterations(positionIterations, 6);
+	SetVelocityIterations(velocityIterations, 2);
+}
+
+void SolverTuner::Run(SolverTuningScenario& scenario, std::vector<SolverTuningResult>& results)
+{
+	const PxSolverType::Enum solverTypes[] = { PxSolverType::ePGS, PxSolverType::eTGS };
+	const PxFrictionType::Enum frictionTypes[] = { PxFrictionType::ePATCH, PxFrictionType::eONE_DIRECTIONAL, PxFrictionType::eTWO_DIRECTIONAL };
+	const PxU32 nbFrictionTypes = scenario.UsesContacts() ? 3 : 1;
+
+	for (PxSolverType::Enum solverType : solverTypes)
+	{
+		for (PxU32 i = 0; i < nbFrictionTypes; i++)
+		{
+			for (PxU32 velocityIterations : m_VelocityIterations)
+			{
+				for (PxU32 positionIterations : m_PositionIterations)
+				{
+					const SolverSettings settings = { solverType, frictionTypes[i], positionIterations, velocityIterations };
+					results.push_back(Measure(scenario, settings));
+				}
+			}
+		}
+	}
+}
+
+SolverTuningResult SolverTuner::Measure(SolverTuningScenario& scenario, const SolverSettings& settings)
+{
+	PxSceneDesc sceneDesc(m_Physics.getTolerancesScale());
+	sceneDesc.gravity = PxVec3(0.0f, -9.81f, 0.0f);
+	sceneDesc.cpuDispatcher = &m_Dispatcher;
+	sceneDesc.filterShader = PxDefaultSimulationFilterShader;
+	sceneDesc.solverType = settings.solverType;
+	sceneDesc.frictionType = settings.frictionType;
+
+	PxScene* scene = m_Physics.createScene(sceneDesc);
+
+	scenario.Build(m_Physics, *scene, m_Material);
+	ApplyIterations(*scene, settings);
+
+	SolverTuningResult result = { settings, 0.0f, 0.0f, 0.0f };
+	PxU64 ticks = 0;
+
+	const PxU32 nbFrames = m_WarmUpFrames + m_MeasureFrames;
+
+	for (PxU32 i = 0; i < nbFrames; i++)
+	{
+		const PxU64 start = SnippetUtils::getCurrentTimeCounterValue();
+		scene->simulate(1.0f / 60.0f);
+		scene->fetchResults(true);
+
+		// ó   ĳÿ ۰ ڸ ̶ ð .  ó .
+		if (i >= m_WarmUpFrames)
+		{
+			ticks += SnippetUtils::getCurrentTimeCounterValue() - start;
+		}
+
+		const PxReal error = scenario.MeasureError();
+		result.maxError = PxMax(result.maxError, error);
+		result.avgError += error / PxReal(nbFrames);
+	}
+
+	result.stepMs = m_MeasureFrames ? SnippetUtils::getElapsedTimeInMilliseconds(ticks) / PxReal(m_MeasureFrames) : 0.0f;
+
+	scenario.Clear();
+	ReleaseScene(*scene);
+
+	return result;
+}
+
+PxU32 SolverTuner::FindCheapest(const std::vector<SolverTuningResult>& results, PxReal tolerance)
+{
+	PxU32 best = PX_MAX_U32;
+
+	for (PxU32 i = 0; i < PxU32(results.size()); i++)
+	{
+		if (results[i].maxError <= tolerance && (best == PX_MAX_U32 || results[i].stepMs < results[best].stepMs))
+		{
+			best = i;
+		}
+	}
+
+	return best;
+}
+
+const char* SolverTuner::GetSolverTypeName(PxSolverType::Enum type)
+{
+	return type == PxSolverType::eTGS ? "TGS" : "PGS";
+}
+
+const char* SolverTuner::GetFrictionTypeName(PxFrictionType::Enum type)
+{
+	switch (type)
+	{
+	case PxFrictionType::ePATCH:			return "patch";
+	case PxFrictionType::eONE_DIRECTIONAL:	return "one dir";
+	case PxFrictionType::eTWO_DIRECTIONAL:	return "two dir";
+	default:								return "?";
+	}
+}
+
+void SolverTuner::ApplyIterations(PxScene& scene, const SolverSettings& settings)
+{
+	m_ActorBuffer.resize(scene.getNbActors(PxActorTypeFlag::eRIGID_DYNAMIC));
+	const PxU32 nbActors = scene.getActors(PxActorTypeFlag::eRIGID_DYNAMIC, m_ActorBuffer.data(), PxU32(m_ActorBuffer.size()));
+
+	for (PxU32 i = 0; i < nbActors; i++)
+	{
+		static_cast<PxRigidDynamic*>(m_ActorBuffer[i])->setSolverIterationCounts(settings.positionIterations, settings.velocityIterations);
+	}
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+
+/*
+	ֹ  Ž.
+
+	ֹ (PGS / TGS),  , ġ / ӵ ݺ Ƚ ո    ó ,
+	 ð ó   Ѵ.
+	ֹ   PxSceneDesc    Ƿ ո  ٽ .
+	ݺ Ƚ ó   ̳ ٵ   ִ´.
+
+	ó ϳ  η ϳ(ü, ,  ...) ô´.
+	 η  ٸǷ(Ʈ , İ,   и) ġ ó Ѵ.
+	FindCheapest    ִ  ġ ȿ     ð  ª  .
+
+	
+		SolverTuner tuner(*physics, *dispatcher, *material);
+		std::vector<SolverTuningResult> results;
+		tuner.Run(scenario, results);
+		const PxU32 best = SolverTuner::FindCheapest(results, scenario.GetTolerance());
+*/
+
+struct SolverSettings
+{
+	physx::PxSolverType::Enum	solverType;
+	physx::PxFrictionType::Enum	frictionType;
+	physx::PxU32				positionIterations;
+	physx::PxU32				velocityIterations;
+};
+
+struct SolverTuningResult
+{
+	SolverSettings	settings;
+	physx::PxReal	stepMs;		//   
+	physx::PxReal	maxError;	//    ִ
+	physx::PxReal	avgError;
+};
+
+class SolverTuningScenario
+{
+public:
+	virtual ~SolverTuningScenario() = default;
+
+	virtual const char*		GetName() const = 0;
+	virtual const char*		GetErrorName() const = 0;
+	virtual physx::PxReal	GetTolerance() const = 0;
+
+	//   ó   ٲ㵵 Ƿ ePATCH  .
+	virtual bool			UsesContacts() const { return true; }
+
+	//   Ϳ Ʈ ִ´.   SolverTuner   Բ Ѵ.
+	virtual void			Build(physx::PxPhysics& physics, physx::PxScene& scene, physx::PxMaterial& material) = 0;
+
+	//   fetchResults ڿ ȣ.   PX_MAX_F32  ൵ ȴ.
+	virtual physx::PxReal	MeasureError() const = 0;
+
+	// Build   ִ ͸ .
+	virtual void			Clear() = 0;
+};
+
+class SolverTuner
+{
+public:
+	SolverTuner(physx::PxPhysics& physics, physx::PxCpuDispatcher& dispatcher, physx::PxMaterial& material);
+
+	void SetFrames(physx::PxU32 warmUpFrames, physx::PxU32 measureFrames) { m_WarmUpFrames = warmUpFrames; m_MeasureFrames = measureFrames; }
+	void SetPositionIterations(const physx::PxU32* counts, physx::PxU32 nbCounts) { m_PositionIterations.assign(counts, counts + nbCounts); }
+	void SetVelocityIterations(const physx::PxU32* counts, physx::PxU32 nbCounts) { m_VelocityIterations.assign(counts, counts + nbCounts); }
+
+	//    results ڿ δ.
+	void Run(SolverTuningScenario& scenario, std::vector<SolverTuningResult>& results);
+
+	//  ϳ .
+	SolverTuningResult Measure(SolverTuningScenario& scenario, const SolverSettings& settings);
+
+	// ġ ϴ    ε.  PX_MAX_U32.
+	static physx::PxU32 FindCheapest(const std::vector<SolverTuningResult>& results, physx::PxReal tolerance);
+
+	static const char* GetSolverTypeName(physx::PxSolverType::Enum type);
+	static const char* GetFrictionTypeName(physx::PxFrictionType::Enum type);
+
+private:
+	void ApplyIterations(physx::PxScene& scene, const SolverSettings& settings);
+
+private:
+	physx::PxPhysics&		m_Physics;
+	physx::PxCpuDispatcher&	m_Dispatcher;
+	physx::PxMaterial&		m_Material;
+
+	physx::PxU32	m_WarmUpFrames;
+	physx::PxU32	m_MeasureFrames;
+
+	std::vector<physx::PxU32>	m_PositionIterations;
+	std::vector<physx::PxU32>	m_VelocityIterations;
+
+	std::vector<physx::PxActor*>		m_ActorBuffer;
+};
@@ -0,0 +1,148 @@
+#include "TaskChain.h"
+
+using namespace physx;
+
+void TaskChain::CallbacksTask::run()
+{
+	// ̾ ½ũ EndTask   ɰ   ½ũ  ǪǷ EndTask    ʴ´.
+	m_Chain->Submit(m_Chain->m_AfterCallbacks);
+}
+
+void TaskChain::CallbacksTask::release()
+{
+	//   ÷׸ . EndTask    Ǯ    ÷׸  ʴ´.
+	m_Chain->m_CallbacksDone = true;
+	SnippetUtils::syncSet(m_Chain->m_CallbacksSync);
+	PxLightCpuTask::release();
+}
+
+void TaskChain::EndTask::release()
+{
+	// syncSet Ŀ Wait  ư ü   Ƿ syncSet   Ѵ.
+	PxLightCpuTask::release();
+	m_Chain->m_EndDone = true;
+	SnippetUtils::syncSet(m_Chain->m_EndSync);
+}
+
+TaskChain::TaskChain()
+	: m_NextJob(0)
+	, m_CallbacksDone(true)
+	, m_EndDone(true)
+	, m_Running(false)
+	, m_IdleMs(0.0f)
+{
+	m_CallbacksTask.m_Chain = this;
+	m_EndTask.m_Chain = this;
+	m_CallbacksSync = SnippetUtils::syncCreate();
+	m_EndSync = SnippetUtils::syncCreate();
+}
+
+TaskChain::~TaskChain()
+{
+	Wait();
+	SnippetUtils::syncRelease(m_CallbacksSync);
+	SnippetUtils::syncRelease(m_EndSync);
+}
+
+void TaskChain::AddMainThreadJob(MainThreadJob job, void* userData)
+{
+	Job it = { job, userData };
+	m_Jobs.push_back(it);
+}
+
+void TaskChain::Clear()
+{
+	Wait();
+	m_AfterCallbacks.clear();
+	m_AfterFetch.clear();
+	m_Jobs.clear();
+}
+
+void TaskChain::ProcessCallbacks(PxScene& scene)
+{
+	PX_ASSERT(!m_Running);
+
+	PxTaskManager& taskManager = *scene.getTaskManager();
+
+	m_Running = true;
+	m_NextJob = 0;
+	m_IdleMs = 0.0f;
+	m_CallbacksDone = false;
+	m_EndDone = false;
+	SnippetUtils::syncReset(m_CallbacksSync);
+	SnippetUtils::syncReset(m_EndSync);
+
+	// EndTask   ϳ FetchResultsFinish  AfterFetch ½ũ     д.
+	m_EndTask.setContinuation(taskManager, nullptr);
+	m_CallbacksTask.setContinuation(taskManager, &m_EndTask);
+
+	scene.processCallbacks(&m_CallbacksTask);
+	m_CallbacksTask.removeReference();
+}
+
+void TaskChain::FetchResultsFinish(PxScene& scene)
+{
+	PX_ASSERT(m_Running);
+
+	WaitFor(m_CallbacksDone, m_CallbacksSync);
+
+	scene.fetchResultsFinish();
+
+	Submit(m_AfterFetch);
+	m_EndTask.removeReference();
+}
+
+void TaskChain::Wait()
+{
+	if (!m_Running)
+	{
+		return;
+	}
+
+	WaitFor(m_EndDone, m_EndSync);
+
+	// ݹ       ۾ ⼭  Ѵ.
+	RunMainThreadJobs();
+	m_Running = false;
+}
+
+void TaskChain::Submit(const std::vector<PxLightCpuTask*>& tasks)
+{
+	PxTaskManager& taskManager = *m_EndTask.getTaskManager();
+
+	for (PxLightCpuTask* task : tasks)
+	{
+		task->setContinuation(taskManager, &m_EndTask);
+		task->removeReference();
+	}
+}
+
+void TaskChain::RunMainThreadJobs()
+{
+	while (m_NextJob < m_Jobs.size())
+	{
+		const Job& it = m_Jobs[m_NextJob++];
+		it.job(it.userData);
+	}
+}
+
+void TaskChain::WaitFor(const std::atomic<bool>& done, SnippetUtils::Sync* sync)
+{
+	// ۾ ϳ   Ȯؼ ٸ ܰ谡   ڷ ̷.
+	while (!done && m_NextJob < m_Jobs.size())
+	{
+		const Job& it = m_Jobs[m_NextJob++];
+		it.job(it.userData);
+	}
+
+	// ÷װ  syncSet     Ƿ ׻ sync  ٸ. ̹   ٷ ƿ´.
+	if (done)
+	{
+		SnippetUtils::syncWait(sync);
+		return;
+	}
+
+	const PxU64 start = SnippetUtils::getCurrentTimeCounterValue();
+	SnippetUtils::syncWait(sync);
+	m_IdleMs += SnippetUtils::getElapsedTimeInMilliseconds(SnippetUtils::getCurrentTimeCounterValue() - start);
+}
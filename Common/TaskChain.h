@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+#include "task/PxTask.h"
+
+#include "SnippetUtils.h"
+
+/*
+	fetchResultsStart / processCallbacks / fetchResultsFinish ڿ ۾ ̾ ̴  ½ũ ׷.
+
+	 ½ũ   ٽ ǹǷ   Add ϸ ȴ.
+		AddAfterCallbacks	: ùķ̼ ݹ   Ŀ . (ݹ  ͷ    )
+		AddAfterFetch		: fetchResultsFinish  Ŀ . (AI, Ʈũ    д ۾)
+		AddMainThreadJob	: ݹ    尡  óѴ. ̳ ̹  ݹ  ǵ帮  ȴ.
+
+	  ٷ      ۾ óϰ,     .
+
+	
+		chain.ProcessCallbacks(*scene);		// fetchResultsStart 
+		chain.FetchResultsFinish(*scene);	//  ۾ Ŀ ۵ȴ
+		...   ۾ ...
+		chain.Wait();						//  simulate ,  ϱ 
+*/
+
+class TaskChain
+{
+public:
+	typedef void (*MainThreadJob)(void* userData);
+
+public:
+	TaskChain();
+	~TaskChain();
+
+	void AddAfterCallbacks(physx::PxLightCpuTask& task) { m_AfterCallbacks.push_back(&task); }
+	void AddAfterFetch(physx::PxLightCpuTask& task) { m_AfterFetch.push_back(&task); }
+	void AddMainThreadJob(MainThreadJob job, void* userData);
+
+	//  ½ũ ۾  .
+	void Clear();
+
+	// processCallbacks  θ ٷ ƿ´.
+	void ProcessCallbacks(physx::PxScene& scene);
+
+	// ݹ ⸦ (  ۾ ϸ鼭) ٸ  fetchResultsFinish  θ AfterFetch ½ũ Ѵ.
+	void FetchResultsFinish(physx::PxScene& scene);
+
+	// ̹ ӿ   ½ũ   ٸ.
+	void Wait();
+
+	bool IsRunning() const { return m_Running; }
+
+	//  ӿ  尡   ִ ð.
+	physx::PxReal GetLastIdleMilliseconds() const { return m_IdleMs; }
+
+private:
+	class CallbacksTask : public physx::PxLightCpuTask
+	{
+	public:
+		TaskChain* m_Chain;
+
+		virtual void run() override;
+		virtual void release() override;
+		virtual const char* getName() const override { return "TaskChain.Callbacks"; }
+	};
+
+	class EndTask : public physx::PxLightCpuTask
+	{
+	public:
+		TaskChain* m_Chain;
+
+		virtual void run() override {}
+		virtual void release() override;
+		virtual const char* getName() const override { return "TaskChain.End"; }
+	};
+
+	struct Job
+	{
+		MainThreadJob	job;
+		void*			userData;
+	};
+
+	void Submit(const std::vector<physx::PxLightCpuTask*>& tasks);
+	void RunMainThreadJobs();
+	void WaitFor(const std::atomic<bool>& done, physx::SnippetUtils::Sync* sync);
+
+private:
+	std::vector<physx::PxLightCpuTask*>	m_AfterCallbacks;
+	std::vector<physx::PxLightCpuTask*>	m_AfterFetch;
+	std::vector<Job>					m_Jobs;
+	physx::PxU32						m_NextJob;
+
+	CallbacksTask	m_CallbacksTask;
+	EndTask			m_EndTask;
+
+	physx::SnippetUtils::Sync*	m_CallbacksSync;
+	physx::SnippetUtils::Sync*	m_EndSync;
+	std::atomic<bool>			m_CallbacksDone;
+	std::atomic<bool>			m_EndDone;
+
+	bool			m_Running;
+	physx::PxReal	m_IdleMs;
+};
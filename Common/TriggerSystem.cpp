@@ -0,0 +1,221 @@
+#include "TriggerSystem.h"
+
+#include <algorithm>
+
+#include "SnippetUtils.h"
+
+using namespace physx;
+
+TriggerSystem::TriggerSystem()
+	: m_Physics(nullptr)
+	, m_Scene(nullptr)
+	, m_Material(nullptr)
+	, m_PollInterval(1)
+	, m_Frame(0)
+	, m_HitBuffer(INITIAL_POLL_HITS)
+	, m_EventMs(0.0f)
+	, m_PollMs(0.0f)
+	, m_NbPolled(0)
+{
+}
+
+TriggerSystem::~TriggerSystem()
+{
+	Release();
+}
+
+void TriggerSystem::Init(PxPhysics& physics, PxScene& scene)
+{
+	Release();
+
+	m_Physics = &physics;
+	m_Scene = &scene;
+	m_Material = physics.createMaterial(0.0f, 0.0f, 0.0f);
+	m_Frame = 0;
+}
+
+void TriggerSystem::Release()
+{
+	for (auto& it : m_Triggers)
+	{
+		PX_RELEASE(it.actor);
+	}
+
+	m_Triggers.clear();
+	m_Pending.clear();
+	m_Events.clear();
+	m_PolledTriggers.clear();
+
+	PX_RELEASE(m_Material);
+	m_Physics = nullptr;
+	m_Scene = nullptr;
+}
+
+PxU32 TriggerSystem::AddTrigger(const PxGeometry& geometry, const PxTransform& pose, TriggerMode mode)
+{
+	PX_ASSERT(m_Physics);
+
+	const PxU32 index = PxU32(m_Triggers.size());
+
+	m_Triggers.push_back(Trigger());
+	Trigger& trigger = m_Triggers.back();
+	trigger.mode = mode;
+	trigger.actor = nullptr;
+	trigger.pose = pose;
+
+	if (mode == TriggerMode::eEVENTS)
+	{
+		PxShape* shape = m_Physics->createShape(geometry, *m_Material, true,
+			PxShapeFlag::eVISUALIZATION | PxShapeFlag::eTRIGGER_SHAPE);
+
+		// onTrigger  Ʈ ȣ ٷ ã userData  ־д.
+		trigger.actor = m_Physics->createRigidStatic(pose);
+		trigger.actor->attachShape(*shape);
+		trigger.actor->userData = reinterpret_cast<void*>(size_t(index));
+		shape->release();
+
+		m_Scene->addActor(*trigger.actor);
+	}
+	else
+	{
+		trigger.geometry.storeAny(geometry);
+		m_PolledTriggers.push_back(index);
+	}
+
+	return index;
+}
+
+void TriggerSystem::OnTrigger(const PxTriggerPair* pairs, PxU32 count)
+{
+	for (PxU32 i = 0; i < count; i++)
+	{
+		const PxTriggerPair& pair = pairs[i];
+
+		// Ʈ   Ѵ. 밡    óؾ ϹǷ .
+		if (pair.flags & PxTriggerPairFlag::eREMOVED_SHAPE_TRIGGER)
+		{
+			continue;
+		}
+
+		PendingEvent event;
+		event.triggerActor = pair.triggerActor;
+		event.trigger = PxU32(size_t(pair.triggerActor->userData));
+		event.type = pair.status == PxPairFlag::eNOTIFY_TOUCH_FOUND ? TriggerEventType::eENTER : TriggerEventType::eEXIT;
+		event.actor = pair.otherActor;
+		m_Pending.push_back(event);
+	}
+}
+
+void TriggerSystem::Update()
+{
+	m_Events.clear();
+
+	PxU64 start = SnippetUtils::getCurrentTimeCounterValue();
+
+	for (const PendingEvent& it : m_Pending)
+	{
+		//  ý   Ʈ ̺Ʈ ɷ.
+		if (it.trigger < m_Triggers.size() && m_Triggers[it.trigger].actor == it.triggerActor)
+		{
+			ApplyEvent(it.trigger, it.type, it.actor);
+		}
+	}
+
+	m_Pending.clear();
+	m_EventMs = SnippetUtils::getElapsedTimeInMilliseconds(SnippetUtils::getCurrentTimeCounterValue() - start);
+
+	// Ʈ ȣ       ŭ Ѵ.
+	start = SnippetUtils::getCurrentTimeCounterValue();
+	m_NbPolled = 0;
+
+	for (PxU32 trigger : m_PolledTriggers)
+	{
+		if ((trigger + m_Frame) % m_PollInterval == 0)
+		{
+			Poll(trigger);
+			m_NbPolled++;
+		}
+	}
+
+	m_PollMs = SnippetUtils::getElapsedTimeInMilliseconds(SnippetUtils::getCurrentTimeCounterValue() - start);
+	m_Frame++;
+}
+
+void TriggerSystem::ApplyEvent(PxU32 trigger, TriggerEventType type, const PxRigidActor* actor)
+{
+	std::vector<const PxRigidActor*>& occupants = m_Triggers[trigger].occupants;
+	auto it = std::lower_bound(occupants.begin(), occupants.end(), actor);
+	const bool found = it != occupants.end() && *it == actor;
+
+	//  ·    ̺Ʈ .
+	if (type == TriggerEventType::eENTER && !found)
+	{
+		occupants.insert(it, actor);
+	}
+	else if (type == TriggerEventType::eEXIT && found)
+	{
+		occupants.erase(it);
+	}
+	else
+	{
+		return;
+	}
+
+	TriggerEvent event = { trigger, type, actor };
+	m_Events.push_back(event);
+}
+
+void TriggerSystem::Poll(PxU32 trigger)
+{
+	Trigger& it = m_Triggers[trigger];
+
+	//  ͸,  Ʈ   ޴´.
+	// ۰   ߸   Ƿ ÷ ٽ ´. ߸ ä θ  Ͱ / ݺѴ.
+	const PxQueryFilterData filterData(PxQueryFlag::eDYNAMIC | PxQueryFlag::eNO_BLOCK);
+	PxOverlapBuffer buffer(m_HitBuffer.data(), PxU32(m_HitBuffer.size()));
+	m_Scene->overlap(it.geometry.any(), it.pose, buffer, filterData);
+
+	while (buffer.getNbTouches() == m_HitBuffer.size())
+	{
+		m_HitBuffer.resize(m_HitBuffer.size() * 2);
+		buffer = PxOverlapBuffer(m_HitBuffer.data(), PxU32(m_HitBuffer.size()));
+		m_Scene->overlap(it.geometry.any(), it.pose, buffer, filterData);
+	}
+
+	m_Hits.clear();
+
+	for (PxU32 i = 0; i < buffer.getNbTouches(); i++)
+	{
+		m_Hits.push_back(buffer.getTouch(i).actor);
+	}
+
+	//    ʹ   .
+	std::sort(m_Hits.begin(), m_Hits.end());
+	m_Hits.erase(std::unique(m_Hits.begin(), m_Hits.end()), m_Hits.end());
+
+	// ĵ    Ⱦ ̸ ̺Ʈ .
+	const std::vector<const PxRigidActor*>& occupants = it.occupants;
+	PxU32 a = 0;
+	PxU32 b = 0;
+
+	while (a < occupants.size() || b < m_Hits.size())
+	{
+		if (b == m_Hits.size() || (a < occupants.size() && occupants[a] < m_Hits[b]))
+		{
+			TriggerEvent event = { trigger, TriggerEventType::eEXIT, occupants[a++] };
+			m_Events.push_back(event);
+		}
+		else if (a == occupants.size() || m_Hits[b] < occupants[a])
+		{
+			TriggerEvent event = { trigger, TriggerEventType::eENTER, m_Hits[b++] };
+			m_Events.push_back(event);
+		}
+		else
+		{
+			a++;
+			b++;
+		}
+	}
+
+	it.occupants.swap(m_Hits);
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+
+/*
+	  Ʈ (,  ) ϴ ý.
+
+	ƮŸ     ϳ .
+		TriggerMode::eEVENTS	:  Ʈ   ְ onTrigger ̺Ʈ Ѵ.
+								  ε    ֹǷ ġ  .
+		TriggerMode::ePOLLED	:  ƹ͵  ʰ Update    ȮѴ.
+								  SetPollInterval(n)̸ n ӿ   , ƮŸ    д.
+								  ùķ̼     ̿   ʹ ĥ  ִ.
+
+	     · ´.
+		- Ӹ / ̺Ʈ  迭(GetEvents) δ.
+		- ƮŸ  ȿ ִ   (GetOccupants) ̺Ʈ ݾ Ѵ.   ĵǾ ִ.
+
+	
+		onTrigger		: triggers.OnTrigger(pairs, count);	// ̺Ʈ Ƶα⸸ Ѵ.
+		fetchResults 	: triggers.Update();					// ̺Ʈ  + 
+*/
+
+enum class TriggerMode
+{
+	eEVENTS,
+	ePOLLED,
+};
+
+enum class TriggerEventType : physx::PxU32
+{
+	eENTER,
+	eEXIT,
+};
+
+struct TriggerEvent
+{
+	physx::PxU32				trigger;
+	TriggerEventType			type;
+	const physx::PxRigidActor*	actor;
+};
+
+class TriggerSystem
+{
+public:
+	static const physx::PxU32 INVALID_TRIGGER = 0xffffffff;
+
+	//  Ʈ  ó ũ.  ۸ ä   ÷ ٽ ´.
+	static const physx::PxU32 INITIAL_POLL_HITS = 256;
+
+public:
+	TriggerSystem();
+	~TriggerSystem();
+
+	void Init(physx::PxPhysics& physics, physx::PxScene& scene);
+	void Release();
+
+	// Ʈ ȣ ش. ȣ 0 ʷ ٴ´.
+	physx::PxU32 AddTrigger(const physx::PxGeometry& geometry, const physx::PxTransform& pose, TriggerMode mode);
+
+	void SetPollInterval(physx::PxU32 frames) { m_PollInterval = frames ? frames : 1; }
+
+	// PxSimulationEventCallback::onTrigger  ȣ.
+	void OnTrigger(const physx::PxTriggerPair* pairs, physx::PxU32 count);
+
+	// fetchResults   忡 ȣ.
+	void Update();
+
+	physx::PxU32				GetNbTriggers() const { return physx::PxU32(m_Triggers.size()); }
+	physx::PxU32				GetNbEvents() const { return physx::PxU32(m_Events.size()); }
+	const TriggerEvent*			GetEvents() const { return m_Events.data(); }
+	physx::PxU32				GetNbOccupants(physx::PxU32 trigger) const { return physx::PxU32(m_Triggers[trigger].occupants.size()); }
+	const physx::PxRigidActor* const*	GetOccupants(physx::PxU32 trigger) const { return m_Triggers[trigger].occupants.data(); }
+
+	//  Update  ̺Ʈ   ɸ ð.
+	physx::PxReal	GetLastEventMilliseconds() const { return m_EventMs; }
+	physx::PxReal	GetLastPollMilliseconds() const { return m_PollMs; }
+	physx::PxU32	GetLastNbPolled() const { return m_NbPolled; }
+
+private:
+	struct Trigger
+	{
+		TriggerMode							mode;
+		physx::PxRigidStatic*				actor;		// eEVENTS 
+		physx::PxGeometryHolder				geometry;	// ePOLLED 
+		physx::PxTransform					pose;
+		std::vector<const physx::PxRigidActor*>	occupants;
+	};
+
+	struct PendingEvent
+	{
+		const physx::PxRigidActor*	triggerActor;
+		physx::PxU32				trigger;
+		TriggerEventType			type;
+		const physx::PxRigidActor*	actor;
+	};
+
+	void ApplyEvent(physx::PxU32 trigger, TriggerEventType type, const physx::PxRigidActor* actor);
+	void Poll(physx::PxU32 trigger);
+
+private:
+	physx::PxPhysics*	m_Physics;
+	physx::PxScene*		m_Scene;
+	physx::PxMaterial*	m_Material;
+
+	std::vector<Trigger>		m_Triggers;
+	std::vector<PendingEvent>	m_Pending;
+	std::vector<TriggerEvent>	m_Events;
+
+	std::vector<physx::PxU32>	m_PolledTriggers;
+	physx::PxU32				m_PollInterval;
+	physx::PxU32				m_Frame;
+
+	std::vector<const physx::PxRigidActor*>	m_Hits;
+	std::vector<physx::PxOverlapHit>		m_HitBuffer;
+
+	physx::PxReal	m_EventMs;
+	physx::PxReal	m_PollMs;
+	physx::PxU32	m_NbPolled;
+};
@@ -0,0 +1,456 @@
+#include "WorldStreamer.h"
+
+#include <stdio.h>
+
+using namespace physx;
+
+WorldStreamer::Desc::Desc()
+	: tileSize(100.0f)
+	, loadRadius(2)
+	, unloadRadius(3)
+	, maxInsertsPerUpdate(1)
+	, maxRemovesPerUpdate(4)
+	, pathPrefix("WorldTile_")
+{
+}
+
+WorldStreamer::WorldStreamer()
+	: m_Physics(nullptr)
+	, m_Scene(nullptr)
+	, m_ExternalRefs(nullptr)
+	, m_Registry(nullptr)
+	, m_Thread(nullptr)
+	, m_WakeSync(nullptr)
+	, m_Mutex(nullptr)
+	, m_Quit(false)
+	, m_NbTilesInScene(0)
+	, m_NbPendingTiles(0)
+	, m_NbInserted(0)
+	, m_NbRemoved(0)
+	, m_LastUpdateMs(0.0f)
+	, m_MaxUpdateMs(0.0f)
+{
+}
+
+WorldStreamer::~WorldStreamer()
+{
+	PX_ASSERT(!m_Thread);
+}
+
+void WorldStreamer::Init(PxPhysics& physics, PxScene& scene, PxCollection* externalRefs, const Desc& desc)
+{
+	PX_ASSERT(desc.unloadRadius > desc.loadRadius);
+
+	m_Physics = &physics;
+	m_Scene = &scene;
+	m_ExternalRefs = externalRefs;
+	m_Desc = desc;
+	m_Registry = PxSerialization::createSerializationRegistry(physics);
+
+	m_Quit = false;
+	m_WakeSync = SnippetUtils::syncCreate();
+	m_Mutex = SnippetUtils::mutexCreate();
+	m_Thread = SnippetUtils::threadCreate(ThreadEntry, this);
+}
+
+void WorldStreamer::Release()
+{
+	if (!m_Thread)
+	{
+		return;
+	}
+
+	m_Quit = true;
+	SnippetUtils::syncSet(m_WakeSync);
+	SnippetUtils::threadWaitForQuit(m_Thread);
+	SnippetUtils::threadRelease(m_Thread);
+	m_Thread = nullptr;
+
+	SnippetUtils::syncRelease(m_WakeSync);
+	SnippetUtils::mutexRelease(m_Mutex);
+	m_WakeSync = nullptr;
+	m_Mutex = nullptr;
+
+	// 尡 Ƿ  Ÿ   .
+	m_RemoveBuffer.clear();
+
+	for (auto& it : m_Tiles)
+	{
+		if (it.second->state == TileState::eIN_SCENE)
+		{
+			for (auto& actor : it.second->actors)
+			{
+				m_RemoveBuffer.push_back(actor);
+			}
+		}
+	}
+
+	if (m_RemoveBuffer.size())
+	{
+		m_Scene->removeActors(&m_RemoveBuffer[0], PxU32(m_RemoveBuffer.size()), false);
+	}
+
+	for (auto& it : m_Tiles)
+	{
+		ReleaseTile(it.second);
+	}
+
+	m_Tiles.clear();
+	m_Arrived.clear();
+	m_Requests.clear();
+	m_Ready.clear();
+	m_RemoveBuffer.clear();
+
+	PX_RELEASE(m_Registry);
+
+	m_NbTilesInScene = 0;
+	m_NbPendingTiles = 0;
+}
+
+bool WorldStreamer::BakeTile(PxI32 x, PxI32 z, const std::vector<PxRigidActor*>& actors)
+{
+	if (actors.empty())
+	{
+		return false;
+	}
+
+	PxPruningStructure* pruningStructure = m_Physics->createPruningStructure(&actors[0], PxU32(actors.size()));
+
+	if (!pruningStructure)
+	{
+		return false;
+	}
+
+	//   ͵, Ͱ  ޽ø ϹǷ complete  ѹ .
+	PxCollection* collection = PxCreateCollection();
+	collection->add(*pruningStructure);
+	PxSerialization::complete(*collection, *m_Registry, m_ExternalRefs);
+
+	bool result = false;
+	{
+		PxDefaultFileOutputStream output(GetTilePath(x, z).c_str());
+
+		if (output.isValid())
+		{
+			result = PxSerialization::serializeCollectionToBinary(output, *collection, *m_Registry, m_ExternalRefs);
+		}
+	}
+
+	collection->release();
+
+	for (auto& it : actors)
+	{
+		it->release();
+	}
+
+	pruningStructure->release();
+
+	return result;
+}
+
+bool WorldStreamer::HasTile(PxI32 x, PxI32 z) const
+{
+	PxDefaultFileInputData input(GetTilePath(x, z).c_str());
+	return input.isValid();
+}
+
+void WorldStreamer::Update(const PxVec3& focus)
+{
+	const PxU64 start = SnippetUtils::getCurrentTimeCounterValue();
+
+	const PxI32 focusX = PxI32(PxFloor(focus.x / m_Desc.tileSize));
+	const PxI32 focusZ = PxI32(PxFloor(focus.z / m_Desc.tileSize));
+
+	auto distance = [focusX, focusZ](const Tile& tile)
+	{
+		return PxMax(PxAbs(tile.x - focusX), PxAbs(tile.z - focusZ));
+	};
+
+	// 1.    Ÿ ûѴ.
+	m_NewRequests.clear();
+
+	for (PxI32 ring = 0; ring <= m_Desc.loadRadius; ring++)
+	{
+		for (PxI32 dz = -ring; dz <= ring; dz++)
+		{
+			for (PxI32 dx = -ring; dx <= ring; dx++)
+			{
+				if (PxMax(PxAbs(dx), PxAbs(dz)) != ring)
+				{
+					continue;
+				}
+
+				const PxU64 key = MakeKey(focusX + dx, focusZ + dz);
+
+				if (m_Tiles.find(key) != m_Tiles.end())
+				{
+					continue;
+				}
+
+				Tile* tile = new Tile();
+				tile->x = focusX + dx;
+				tile->z = focusZ + dz;
+				tile->state = TileState::ePENDING;
+				tile->collection = nullptr;
+				tile->pruningStructure = nullptr;
+
+				m_Tiles[key] = tile;
+				m_NewRequests.push_back(tile);
+			}
+		}
+	}
+
+	SnippetUtils::mutexLock(m_Mutex);
+	m_Requests.insert(m_Requests.end(), m_NewRequests.begin(), m_NewRequests.end());
+	const size_t nbArrived = m_Arrived.size();
+	m_Arrived.insert(m_Arrived.end(), m_Ready.begin(), m_Ready.end());
+	m_Ready.clear();
+	SnippetUtils::mutexUnlock(m_Mutex);
+
+	// state   常 ٲ۴. δ m_Ready θ Ѱش.
+	for (size_t i = nbArrived; i < m_Arrived.size(); i++)
+	{
+		m_Arrived[i]->state = TileState::eLOADED;
+	}
+
+	if (m_NewRequests.size())
+	{
+		SnippetUtils::syncSet(m_WakeSync);
+	}
+
+	m_NbPendingTiles += PxU32(m_NewRequests.size());
+
+	// 2.  Ÿ ѵ ŭ ִ´.   ־ Ÿ   ʰ ٷ .
+	PxU32 nbInserts = 0;
+	PxU32 nbKept = 0;
+
+	for (auto& tile : m_Arrived)
+	{
+		if (distance(*tile) > m_Desc.unloadRadius)
+		{
+			m_Tiles.erase(MakeKey(tile->x, tile->z));
+			ReleaseTile(tile);
+			m_NbPendingTiles--;
+		}
+		else if (!tile->pruningStructure || nbInserts < m_Desc.maxInsertsPerUpdate)
+		{
+			//   Ÿ  ŸϷ Ѵ.
+			if (tile->pruningStructure)
+			{
+				InsertTile(*tile);
+				nbInserts++;
+			}
+
+			tile->state = TileState::eIN_SCENE;
+			m_NbTilesInScene++;
+			m_NbPendingTiles--;
+		}
+		else
+		{
+			m_Arrived[nbKept++] = tile;
+		}
+	}
+
+	m_Arrived.resize(nbKept);
+
+	// 3. ־ Ÿϵ ͸ Ƽ   .
+	std::vector<Tile*> removed;
+	m_RemoveBuffer.clear();
+
+	for (auto& it : m_Tiles)
+	{
+		Tile* tile = it.second;
+
+		if (tile->state != TileState::eIN_SCENE || distance(*tile) <= m_Desc.unloadRadius)
+		{
+			continue;
+		}
+
+		if (removed.size() >= m_Desc.maxRemovesPerUpdate)
+		{
+			break;
+		}
+
+		removed.push_back(tile);
+
+		for (auto& actor : tile->actors)
+		{
+			m_RemoveBuffer.push_back(actor);
+		}
+	}
+
+	if (m_RemoveBuffer.size())
+	{
+		m_Scene->removeActors(&m_RemoveBuffer[0], PxU32(m_RemoveBuffer.size()), false);
+	}
+
+	for (auto& tile : removed)
+	{
+		m_Tiles.erase(MakeKey(tile->x, tile->z));
+
+		if (tile->pruningStructure)
+		{
+			m_NbRemoved++;
+		}
+
+		ReleaseTile(tile);
+		m_NbTilesInScene--;
+	}
+
+	m_LastUpdateMs = SnippetUtils::getElapsedTimeInMilliseconds(SnippetUtils::getCurrentTimeCounterValue() - start);
+	m_MaxUpdateMs = PxMax(m_MaxUpdateMs, m_LastUpdateMs);
+}
+
+PxBounds3 WorldStreamer::GetTileBounds(PxI32 x, PxI32 z) const
+{
+	const PxReal size = m_Desc.tileSize;
+	return PxBounds3(PxVec3(PxReal(x) * size, -PX_MAX_BOUNDS_EXTENTS, PxReal(z) * size),
+		PxVec3(PxReal(x + 1) * size, PX_MAX_BOUNDS_EXTENTS, PxReal(z + 1) * size));
+}
+
+//////////////////////////////////////////
+
+void WorldStreamer::ThreadEntry(void* data)
+{
+	static_cast<WorldStreamer*>(data)->ThreadLoop();
+}
+
+void WorldStreamer::ThreadLoop()
+{
+	while (!m_Quit)
+	{
+		SnippetUtils::syncWait(m_WakeSync);
+
+		while (!m_Quit)
+		{
+			Tile* tile = nullptr;
+
+			// û   ؾ Update  syncSet  ġ ʴ´.
+			SnippetUtils::mutexLock(m_Mutex);
+			if (m_Requests.size())
+			{
+				tile = m_Requests.front();
+				m_Requests.erase(m_Requests.begin());
+			}
+			else
+			{
+				SnippetUtils::syncReset(m_WakeSync);
+			}
+			SnippetUtils::mutexUnlock(m_Mutex);
+
+			if (!tile)
+			{
+				break;
+			}
+
+			LoadTile(*tile);
+
+			SnippetUtils::mutexLock(m_Mutex);
+			m_Ready.push_back(tile);
+			SnippetUtils::mutexUnlock(m_Mutex);
+		}
+	}
+}
+
+std::string WorldStreamer::GetTilePath(PxI32 x, PxI32 z) const
+{
+	char name[32];
+	snprintf(name, sizeof(name), "%d_%d.bin", x, z);
+
+	return m_Desc.pathPrefix + name;
+}
+
+void WorldStreamer::LoadTile(Tile& tile)
+{
+	PxDefaultFileInputData input(GetTilePath(tile.x, tile.z).c_str());
+
+	if (!input.isValid())
+	{
+		return;
+	}
+
+	// ̳ʸ ȭ PX_SERIAL_FILE_ALIGN   ޸𸮰 ʿϴ.
+	const PxU32 length = input.getLength();
+	tile.memory.resize(length + PX_SERIAL_FILE_ALIGN);
+
+	void* aligned = reinterpret_cast<void*>((size_t(&tile.memory[0]) + PX_SERIAL_FILE_ALIGN - 1) & ~size_t(PX_SERIAL_FILE_ALIGN - 1));
+	input.read(aligned, length);
+
+	tile.collection = PxSerialization::createCollectionFromBinary(aligned, *m_Registry, m_ExternalRefs);
+
+	if (tile.collection)
+	{
+		const PxU32 nbObjects = tile.collection->getNbObjects();
+
+		for (PxU32 i = 0; i < nbObjects; i++)
+		{
+			PxBase& object = tile.collection->getObject(i);
+
+			if (object.is<PxPruningStructure>())
+			{
+				tile.pruningStructure = object.is<PxPruningStructure>();
+			}
+		}
+	}
+}
+
+void WorldStreamer::InsertTile(Tile& tile)
+{
+	const PxU32 nbActors = tile.pruningStructure->getNbRigidActors();
+	tile.actors.resize(nbActors);
+	tile.pruningStructure->getRigidActors(&tile.actors[0], nbActors);
+
+	// Ʈ   ʰ ̸    ״    δ.
+	m_Scene->addActors(*tile.pruningStructure);
+
+	m_NbInserted++;
+}
+
+void WorldStreamer::ReleaseTile(Tile* tile)
+{
+	if (tile->collection)
+	{
+		// ͸ ϸ    ǹǷ   Ʈ д.
+		std::vector<PxBase*> others;
+		std::vector<PxRigidActor*> actors;
+
+		const PxU32 nbObjects = tile->collection->getNbObjects();
+
+		for (PxU32 i = 0; i < nbObjects; i++)
+		{
+			PxBase& object = tile->collection->getObject(i);
+
+			if (object.is<PxRigidActor>())
+			{
+				actors.push_back(object.is<PxRigidActor>());
+			}
+			else if (object.is<PxPruningStructure>())
+			{
+				continue;
+			}
+			else if (!object.is<PxShape>() || !object.is<PxShape>()->isExclusive())
+			{
+				others.push_back(&object);
+			}
+		}
+
+		for (auto& it : actors)
+		{
+			it->release();
+		}
+
+		if (tile->pruningStructure)
+		{
+			tile->pruningStructure->release();
+		}
+
+		for (auto& it : others)
+		{
+			it->release();
+		}
+
+		tile->collection->release();
+	}
+
+	delete tile;
+}
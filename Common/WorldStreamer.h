@@ -0,0 +1,121 @@
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+
+#include "SnippetUtils.h"
+
+/*
+	 带 XZ  簢 ŸϷ   ֺ  ÷δ Ʈ .
+
+	- BakeTile() Ÿ  ͵ PxPruningStructure  ̳ʸ ̸ صд.
+	- ׶ 尡 Ÿ  о ȭ  ´.
+	-   Update() غ Ÿ addActors(pruningStructure)   ְ,
+	  ־ Ÿϵ removeActors   Ƽ .
+	    Update  ְ  Ÿ  Desc  ؼ Ӵ  д.
+
+	ó  Ÿ   Ʈ externalRefs ÷ǿ id ٿ ѱ.
+	PxPhysics  Ʈ  忡 ϹǷ ȭ ùķ̼ ߿   ִ.
+	 ְ   ùķ̼ ۿ ϹǷ Update() fetchResults Ŀ ȣѴ.
+*/
+
+class WorldStreamer
+{
+public:
+	struct Desc
+	{
+		Desc();
+
+		physx::PxReal	tileSize;
+		physx::PxI32	loadRadius;				//  ŸϿ  Ÿ(Ÿ )  Ÿ ҷ´.
+		physx::PxI32	unloadRadius;			//  Ÿ ־ . loadRadius  Ŀ Ÿ  ʴ´.
+		physx::PxU32	maxInsertsPerUpdate;	// Update     ִ Ÿ 
+		physx::PxU32	maxRemovesPerUpdate;	// Update     ִ Ÿ 
+		std::string		pathPrefix;				// Ÿ   = pathPrefix + "x_z.bin"
+	};
+
+public:
+	WorldStreamer();
+	~WorldStreamer();
+
+	void Init(physx::PxPhysics& physics, physx::PxScene& scene, physx::PxCollection* externalRefs, const Desc& desc = Desc());
+	void Release();
+
+	// ͵ Ÿ  . ͵   ʾƾ ϸ   ȴ.
+	bool BakeTile(physx::PxI32 x, physx::PxI32 z, const std::vector<physx::PxRigidActor*>& actors);
+	bool HasTile(physx::PxI32 x, physx::PxI32 z) const;
+
+	// focus   ǥ.
+	void Update(const physx::PxVec3& focus);
+
+	physx::PxBounds3	GetTileBounds(physx::PxI32 x, physx::PxI32 z) const;
+	physx::PxU32		GetNbTilesInScene() const { return m_NbTilesInScene; }
+	physx::PxU32		GetNbPendingTiles() const { return m_NbPendingTiles; }
+	physx::PxU32		GetNbInserted() const { return m_NbInserted; }
+	physx::PxU32		GetNbRemoved() const { return m_NbRemoved; }
+	physx::PxReal		GetLastUpdateMilliseconds() const { return m_LastUpdateMs; }
+	physx::PxReal		GetMaxUpdateMilliseconds() const { return m_MaxUpdateMs; }
+
+private:
+	enum class TileState
+	{
+		ePENDING,	// ׶ 忡 û
+		eLOADED,	// m_Ready     Ѿ,  
+		eIN_SCENE,
+	};
+
+	struct Tile
+	{
+		physx::PxI32						x;
+		physx::PxI32						z;
+		TileState							state;		//   
+		physx::PxCollection*				collection;
+		physx::PxPruningStructure*			pruningStructure;
+		std::vector<physx::PxU8>			memory;		// ȭ Ʈ ⿡ ִ. Ʈ  ϸ ȵȴ.
+		std::vector<physx::PxRigidActor*>	actors;
+	};
+
+	static void ThreadEntry(void* data);
+	void ThreadLoop();
+
+	std::string	GetTilePath(physx::PxI32 x, physx::PxI32 z) const;
+	void		LoadTile(Tile& tile);
+	void		InsertTile(Tile& tile);
+	void		ReleaseTile(Tile* tile);
+
+	static physx::PxU64 MakeKey(physx::PxI32 x, physx::PxI32 z)
+	{
+		return (physx::PxU64(physx::PxU32(x)) << 32) | physx::PxU32(z);
+	}
+
+private:
+	physx::PxPhysics*					m_Physics;
+	physx::PxScene*						m_Scene;
+	physx::PxCollection*				m_ExternalRefs;
+	physx::PxSerializationRegistry*		m_Registry;
+	Desc								m_Desc;
+
+	std::unordered_map<physx::PxU64, Tile*>	m_Tiles;	//   
+	std::vector<Tile*>						m_Arrived;	//   Ѿ     Ÿ
+	std::vector<Tile*>						m_NewRequests;
+	std::vector<physx::PxActor*>			m_RemoveBuffer;
+
+	//   ׶ 尡  . m_Mutex  ȣ.
+	physx::SnippetUtils::Thread*	m_Thread;
+	physx::SnippetUtils::Sync*		m_WakeSync;
+	physx::SnippetUtils::Mutex*	m_Mutex;
+	std::vector<Tile*>		m_Requests;
+	std::vector<Tile*>		m_Ready;
+	std::atomic<bool>		m_Quit;
+
+	physx::PxU32	m_NbTilesInScene;
+	physx::PxU32	m_NbPendingTiles;
+	physx::PxU32	m_NbInserted;
+	physx::PxU32	m_NbRemoved;
+	physx::PxReal	m_LastUpdateMs;
+	physx::PxReal	m_MaxUpdateMs;
+};
@@ -7,6 +7,9 @@
 #include "SnippetPrint.h"
 #include "SnippetPVD.h"
 #include "SnippetUtils.h"
+#include "ContactModifier.h"
+#include "PosePreview.h"
+#include "SleepTracker.h"
 
 using namespace physx;
 
@@ -21,11 +24,48 @@ PxDefaultCpuDispatcher* gDispatcher = nullptr;
 PxScene* gScene = nullptr;
 
 PxMaterial* gMaterial = nullptr;
+PxMaterial* gBouncyMaterial = nullptr;
 
 PxPvd* gPvd = nullptr;
 
 PxReal stackZ = 10.0f;
 
+// ̾ Ʈ  Ƣ .   Ģ .
+enum ModifyClass : PxU32
+{
+	MODIFY_CLASS_DEFAULT = 0,
+	MODIFY_CLASS_CONVEYOR,
+};
+
+ContactModifier gContactModifier;
+PxRigidStatic* gConveyor = nullptr;
+
+//    ÷̾  onAdvance  fetchResults   ޴´.
+PosePreview gPosePreview;
+PxRigidDynamic* gPlayer = nullptr;
+
+//  ̳ ٵ𸶴 isSleeping()  ʰ     ׸.
+SleepTracker gSleepTracker;
+
+class SimulationCallback : public PxSimulationEventCallback
+{
+	virtual void onConstraintBreak(PxConstraintInfo*, PxU32) override {}
+	virtual void onWake(PxActor** actors, PxU32 count) override
+	{
+		gSleepTracker.OnWake(actors, count);
+	}
+	virtual void onSleep(PxActor** actors, PxU32 count) override
+	{
+		gSleepTracker.OnSleep(actors, count);
+	}
+	virtual void onContact(const PxContactPairHeader&, const PxContactPair*, PxU32) override {}
+	virtual void onTrigger(PxTriggerPair*, PxU32) override {}
+	virtual void onAdvance(const PxRigidBody* const* bodies, const PxTransform* poses, const PxU32 count) override
+	{
+		gPosePreview.OnAdvance(bodies, poses, count);
+	}
+} gSimulationCallback;
+
 PxRigidDynamic* CreateDynamic(const PxTransform& t, const PxGeometry& geometry,
 	const PxVec3& velocity = PxVec3(0));
 void CreateStack(const PxTransform& t, PxU32 size, PxReal halfExtent);
@@ -64,6 +104,14 @@ void InitPhysics(bool interactive)
 	sceneDesc.cpuDispatcher = gDispatcher;
 	sceneDesc.filterShader = PxDefaultSimulationFilterShader;
 
+	// Ģ ̴ ͷ Ǳ   Ѵ.
+	// ̾ Ʈ  x   ,  Ƣ  ٴ  ε  ݹ  ø.
+	gMaterial = gPhysics->createMaterial(0.5f, 0.5f, 0.6f);
+	gBouncyMaterial = gPhysics->createMaterial(0.5f, 0.5f, 0.6f);
+	gContactModifier.AddRule(MODIFY_CLASS_CONVEYOR, MODIFY_CLASS_DEFAULT, ContactModifier::ConveyorRule(PxVec3(8.0f, 0.0f, 0.0f)));
+	gContactModifier.AddMaterialRule(*gBouncyMaterial, *gMaterial, ContactModifier::RestitutionRule(0.95f));
+	gContactModifier.ApplyTo(sceneDesc);
+
 	//  ùķ̼, ̺Ʈ ݹ ̽ Ѵ
 
 	// ݹĢ
@@ -71,7 +119,7 @@ void InitPhysics(bool interactive)
 	// SDK ¸ ϸ ȵǸ Ư ü ϰų ıؼ ȵȴ
 	//   ʿ    ۿ   ùķ̼ ܰ   
 
-	//sceneDesc.simulationEventCallback
+	sceneDesc.simulationEventCallback = &gSimulationCallback;
 	gScene = gPhysics->createScene(sceneDesc);
 	
 	//pvd Ŭ̾Ʈ 
@@ -84,11 +132,27 @@ void InitPhysics(bool interactive)
 		pvdClient->setScenePvdFlag(PxPvdSceneFlag::eTRANSMIT_SCENEQUERIES, true);
 	}
 
-	gMaterial = gPhysics->createMaterial(0.5f, 0.5f, 0.6f);
-
 	PxRigidStatic* groundPlane = PxCreatePlane(*gPhysics, PxPlane(0, 1, 0, 0), *gMaterial);
+	gContactModifier.TagActor(*groundPlane);
 	gScene->addActor(*groundPlane);
 
+	gConveyor = PxCreateStatic(*gPhysics, PxTransform(PxVec3(0.0f, 1.0f, 30.0f)), PxBoxGeometry(30.0f, 1.0f, 4.0f), *gMaterial);
+	ContactModifier::SetActorClass(*gConveyor, MODIFY_CLASS_CONVEYOR);
+	gScene->addActor(*gConveyor);
+
+	for (PxU32 i = 0; i < 5; i++)
+	{
+		PxRigidDynamic* ball = PxCreateDynamic(*gPhysics, PxTransform(PxVec3(-20.0f + PxReal(i) * 10.0f, 20.0f, 45.0f)), PxSphereGeometry(1.5f), *gBouncyMaterial, 10.0f);
+		gContactModifier.TagActor(*ball);
+		gScene->addActor(*ball);
+		gSleepTracker.Add(*ball);
+	}
+
+	for (PxU32 i = 0; i < 10; i++)
+	{
+		CreateDynamic(PxTransform(PxVec3(-25.0f + PxReal(i) * 2.5f, 4.0f, 30.0f)), PxBoxGeometry(1.0f, 1.0f, 1.0f));
+	}
+
 	for (PxU32 i = 0; i < 5; i++)
 	{
 		CreateStack(PxTransform(PxVec3(0, 0, stackZ -= 10.0f)), 10, 2.0f);
@@ -108,6 +172,7 @@ PxRigidDynamic* CreateDynamic(const PxTransform& t, const PxGeometry& geometry,
 	dynamic->setLinearVelocity(velocity);
 
 	gScene->addActor(*dynamic);
+	gSleepTracker.Add(*dynamic);
 
 	return dynamic;
 }
@@ -126,20 +191,38 @@ void CreateStack(const PxTransform& t, PxU32 size, PxReal halfExtent)
 			body->attachShape(*shape);
 			PxRigidBodyExt::updateMassAndInertia(*body, 10.0f);
 			gScene->addActor(*body);
+			gSleepTracker.Add(*body);
 		}
 	}
 
 	shape->release();
 }
 
-void StepPhysics(bool)
+//   simulate  fetchResults ̿ ̸   ׸ ϹǷ  д.
+void SimulatePhysics()
 {
+	gContactModifier.BeginFrame();
+	gPosePreview.BeginStep();
 	gScene->simulate(1.0f / 60.0f);
+}
+
+void FetchPhysics()
+{
 	gScene->fetchResults(true);
 }
 
+void StepPhysics(bool)
+{
+	SimulatePhysics();
+	FetchPhysics();
+}
+
 void CleanupPhysics(bool)
 {
+	gPosePreview.Clear();
+	gPlayer = nullptr;
+	gSleepTracker.Clear();
+
 	PX_RELEASE(gScene);
 	PX_RELEASE(gDispatcher);
 	PX_RELEASE(gPhysics);
@@ -159,7 +242,15 @@ void KeyPress(unsigned char key, const PxTransform& camera)
 	switch (toupper(key))
 	{
 	case 'B':	CreateStack(PxTransform(PxVec3(0, 0, stackZ -= 10.0f)), 10, 2.0f);						break;
-	case ' ':	CreateDynamic(camera, PxSphereGeometry(3.0f), camera.rotate(PxVec3(0, 0, -1)) * 200);	break;
+	case ' ':
+		if (gPlayer)
+		{
+			gPosePreview.Untrack(*gPlayer);
+		}
+
+		gPlayer = CreateDynamic(camera, PxSphereGeometry(3.0f), camera.rotate(PxVec3(0, 0, -1)) * 200);
+		gPosePreview.Track(*gPlayer);
+		break;
 	}
 }
 
@@ -174,6 +265,12 @@ int SnippetMain(int, const char* const*)
 	InitPhysics(false);
 	for (PxU32 i = 0; i < frameCount; i++)
 		StepPhysics(false);
+
+	// BeginFrame    踦 Ѱش.
+	gContactModifier.BeginFrame();
+	const ContactModifier::FrameStats& stats = gContactModifier.GetLastFrameStats();
+	printf("contact modify : %u calls, %u pairs, %u contacts, %.3f ms\n", stats.nbCalls, stats.nbPairs, stats.nbContacts, stats.milliseconds);
+
 	CleanupPhysics(false);
 #endif
 
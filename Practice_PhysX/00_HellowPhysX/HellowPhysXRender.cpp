@@ -1,23 +1,31 @@
 
 #ifdef RENDER_SNIPPET
 #include <vector>
+#include <ctype.h>
 
 #include "PxPhysicsAPI.h"
 #include "SnippetRender.h"
 #include "SnippetCamera.h"
+#include "PosePreview.h"
+#include "SleepTracker.h"
 
 using namespace physx;
 
 extern void InitPhysics(bool interactive);
-extern void StepPhysics(bool interactive);
+extern void SimulatePhysics();
+extern void FetchPhysics();
 extern void CleanupPhysics(bool interactive);
 extern void KeyPress(unsigned char key, const PxTransform& camera);
 
+extern PosePreview gPosePreview;
+extern PxRigidDynamic* gPlayer;
+extern SleepTracker gSleepTracker;
 
 
 namespace
 {
 	Snippets::Camera* sCamera;
+	bool sFollowPlayer = true;	// F Ű ȯ
 
 	void MotionCallback(int x, int y)
 	{
@@ -31,6 +39,12 @@ namespace
 			exit(0);
 		}
 
+		if (toupper(key) == 'F')
+		{
+			sFollowPlayer = !sFollowPlayer;
+			return;
+		}
+
 		if (!sCamera->handleKey(key, x, y))
 		{
 			KeyPress(key, sCamera->getTransform());
@@ -49,25 +63,41 @@ namespace
 
 	void RenderCallback()
 	{
-		StepPhysics(true);
-
-		Snippets::startRender(sCamera->getEye(), sCamera->getDir());
-
 		PxScene* scene;
 		PxGetPhysics().getScenes(&scene, 1);
 
-		
-		PxU32 nbActors = scene->getNbActors(PxActorTypeFlag::eRIGID_DYNAMIC | PxActorTypeFlag::eRIGID_STATIC);
+		SimulatePhysics();
+
+		//   onAdvance  ÷̾ ̹ ܰ   ´.
+		// ݹ ó fetchResults  ٸ ʰ   ī޶  ׸ Ѵ.
+		PxVec3 eye = sCamera->getEye();
+		PxTransform playerPose;
+
+		if (sFollowPlayer && gPlayer && gPosePreview.WaitForStep(*scene) && gPosePreview.GetPose(*gPlayer, playerPose))
+		{
+			eye = playerPose.p - sCamera->getDir() * 25.0f;
+		}
+
+		Snippets::startRender(eye, sCamera->getDir());
+
+		PxU32 nbActors = scene->getNbActors(PxActorTypeFlag::eRIGID_STATIC);
 
 		if (nbActors)
 		{
 			std::vector<PxRigidActor*> actors(nbActors);
-			scene->getActors(PxActorTypeFlag::eRIGID_DYNAMIC | PxActorTypeFlag::eRIGID_STATIC,
-				reinterpret_cast<PxActor**>(&actors[0]), nbActors);
+			scene->getActors(PxActorTypeFlag::eRIGID_STATIC, reinterpret_cast<PxActor**>(&actors[0]), nbActors);
 			Snippets::renderActors(&actors[0], static_cast<PxU32>(actors.size()), true);
 		}
 
+		// ̳ onWake / onSleep    ״ ׸.
+		const PxVec3 color(0.0f, 0.75f, 0.0f);
+		Snippets::renderActors(gSleepTracker.GetAwake(), gSleepTracker.GetNbAwake(), true, color, false);
+		Snippets::renderActors(gSleepTracker.GetAsleep(), gSleepTracker.GetNbAsleep(), true, color, true);
+
 		Snippets::finishRender();
+
+		// ùķ̼  б ǹǷ ٸ ʹ  ܰ  ׷ȴ.   ޴´.
+		FetchPhysics();
 	}
 
 	void ExitCallback(void)
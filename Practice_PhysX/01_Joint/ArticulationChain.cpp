@@ -0,0 +1,127 @@
+#include "ArticulationChain.h"
+
+using namespace physx;
+
+void SetupLimitedSpherical(PxArticulationJointReducedCoordinate& joint)
+{
+	// PxJointLimitCone(PxPi / 4, PxPi / 4)      . Ʋ .
+	joint.setJointType(PxArticulationJointType::eSPHERICAL);
+	joint.setMotion(PxArticulationAxis::eTWIST, PxArticulationMotion::eFREE);
+	joint.setMotion(PxArticulationAxis::eSWING1, PxArticulationMotion::eLIMITED);
+	joint.setMotion(PxArticulationAxis::eSWING2, PxArticulationMotion::eLIMITED);
+	joint.setLimit(PxArticulationAxis::eSWING1, -PxPi / 4, PxPi / 4);
+	joint.setLimit(PxArticulationAxis::eSWING2, -PxPi / 4, PxPi / 4);
+}
+
+void SetupFixed(PxArticulationJointReducedCoordinate& joint)
+{
+	joint.setJointType(PxArticulationJointType::eFIX);
+}
+
+void SetupDampedD6(PxArticulationJointReducedCoordinate& joint)
+{
+	// SLERP ̺( 0,  1000)   ȸ࿡   ̺긦 Ǵ.
+	joint.setJointType(PxArticulationJointType::eSPHERICAL);
+
+	const PxArticulationAxis::Enum axes[] = { PxArticulationAxis::eTWIST, PxArticulationAxis::eSWING1, PxArticulationAxis::eSWING2 };
+	for (PxArticulationAxis::Enum axis : axes)
+	{
+		joint.setMotion(axis, PxArticulationMotion::eFREE);
+		joint.setDrive(axis, 0.0f, 1000.0f, PX_MAX_F32);
+	}
+}
+
+void ArticulationChain::SetSolverIterationCounts(PxU32 position, PxU32 velocity)
+{
+	for (PxArticulationReducedCoordinate* segment : segments)
+	{
+		segment->setSolverIterationCounts(position, velocity);
+	}
+}
+
+void ArticulationChain::Release()
+{
+	for (PxJoint* seam : seams)
+	{
+		seam->release();
+	}
+
+	for (PxArticulationReducedCoordinate* segment : segments)
+	{
+		if (segment->getScene())
+		{
+			segment->getScene()->removeArticulation(*segment);
+		}
+		segment->release();
+	}
+
+	segments.clear();
+	seams.clear();
+	links.clear();
+}
+
+void CreateArticulationChain(PxPhysics& physics, PxScene& scene, PxMaterial& material,
+	const PxTransform& t, PxU32 length, const PxGeometry& g, PxReal separation,
+	ArticulationJointSetupFunction setupJoint, JointCreateFunction createSeamJoint, ArticulationChain& chain)
+{
+	const PxVec3 offset(separation / 2, 0, 0);
+	PxTransform localTm(offset);
+
+	PxArticulationReducedCoordinate* segment = nullptr;
+	PxArticulationLink* parent = nullptr;
+	PxU32 linksInSegment = 0;
+
+	for (PxU32 i = 0; i < length; i++)
+	{
+		if (!segment || linksInSegment == ArticulationChain::MAX_LINKS)
+		{
+			if (segment)
+			{
+				scene.addArticulation(*segment);
+			}
+
+			segment = physics.createArticulationReducedCoordinate();
+			chain.segments.push_back(segment);
+			linksInSegment = 0;
+
+			if (!parent)
+			{
+				// Ʈ ü 忡 ٴ ڸ(t)  Ʈ д.
+				segment->setArticulationFlag(PxArticulationFlag::eFIX_BASE, true);
+				PxArticulationLink* root = segment->createLink(nullptr, t);
+				root->setMass(1.0f);
+				root->setMassSpaceInertiaTensor(PxVec3(1.0f));
+				parent = root;
+				linksInSegment++;
+			}
+		}
+
+		const bool newSegment = linksInSegment == 0;
+		PxArticulationLink* link = segment->createLink(newSegment ? nullptr : parent, t * localTm);
+		PxRigidActorExt::createExclusiveShape(*link, g, material);
+		PxRigidBodyExt::updateMassAndInertia(*link, 1.0f);
+
+		if (newSegment)
+		{
+			//  ׸Ʈ  ũʹ Ϲ Ʈ մ´.
+			chain.seams.push_back((*createSeamJoint)(parent, PxTransform(offset), link, PxTransform(-offset)));
+		}
+		else
+		{
+			PxArticulationJointReducedCoordinate* joint = static_cast<PxArticulationJointReducedCoordinate*>(link->getInboundJoint());
+			joint->setParentPose(i == 0 ? PxTransform(PxIdentity) : PxTransform(offset));
+			joint->setChildPose(PxTransform(-offset));
+			(*setupJoint)(*joint);
+		}
+
+		chain.links.push_back(link);
+		parent = link;
+		linksInSegment++;
+		localTm.p.x += separation;
+	}
+
+	if (segment)
+	{
+		scene.addArticulation(*segment);
+	}
+}
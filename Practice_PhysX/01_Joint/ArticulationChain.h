@@ -0,0 +1,48 @@
+#pragma once
+
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+
+#include "ChainBuilder.h"
+
+/*
+	CreateChain   ü PxArticulationReducedCoordinate   .
+
+	Ʈ ü ũ 6  Ǯ  Ƿ  þ ݺ Ƚ  .
+	Ƽŧ̼  ǥ Ǯ  ũ ̰  ʴ´.
+
+	Ƽŧ̼ ϳ ũ 64    Ƿ,   ü  ׸Ʈ 
+	׸Ʈ ̸ createSeamJoint   Ϲ Ʈ մ´.
+	ù ׸Ʈ Ʈ    ũ(eFIX_BASE), Ʈ üο 忡 ̴ ڸ .
+	Ƽŧ̼   Ƿ  Ʈ ü  䳻 ʴ´.
+
+	
+		ArticulationChain chain;
+		CreateArticulationChain(physics, scene, material, t, length, geometry, separation, SetupLimitedSpherical, CreateLimitedSpherical, chain);
+		...
+		chain.Release();
+*/
+
+typedef void (*ArticulationJointSetupFunction)(physx::PxArticulationJointReducedCoordinate& joint);
+
+// Ʈ ü CreateLimitedSpherical / CreateBreakableFixed / CreateDampedD6    .
+void SetupLimitedSpherical(physx::PxArticulationJointReducedCoordinate& joint);
+void SetupFixed(physx::PxArticulationJointReducedCoordinate& joint);
+void SetupDampedD6(physx::PxArticulationJointReducedCoordinate& joint);
+
+struct ArticulationChain
+{
+	static const physx::PxU32 MAX_LINKS = 64;
+
+	std::vector<physx::PxArticulationReducedCoordinate*>	segments;
+	std::vector<physx::PxJoint*>							seams;		// ׸Ʈ . ݺ Ƚ  Ƽŧ̼ .
+	std::vector<physx::PxRigidBody*>						links;		// ü .  Ʈ .
+
+	void SetSolverIterationCounts(physx::PxU32 position, physx::PxU32 velocity);
+	void Release();
+};
+
+void CreateArticulationChain(physx::PxPhysics& physics, physx::PxScene& scene, physx::PxMaterial& material,
+	const physx::PxTransform& t, physx::PxU32 length, const physx::PxGeometry& g, physx::PxReal separation,
+	ArticulationJointSetupFunction setupJoint, JointCreateFunction createSeamJoint, ArticulationChain& chain);
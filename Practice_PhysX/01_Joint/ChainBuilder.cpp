@@ -0,0 +1,123 @@
+#include "ChainBuilder.h"
+
+using namespace physx;
+
+ChainBuilder::ChainBuilder(PxPhysics& physics, PxMaterial& material)
+	: m_Physics(physics)
+	, m_Material(material)
+	, m_NextChainId(1)
+{
+}
+
+void ChainBuilder::Build(PxScene& scene, const ChainSpec* specs, PxU32 nbSpecs)
+{
+	const size_t firstLink = m_Links.size();
+
+	PxU32 nbLinks = 0;
+	for (PxU32 i = 0; i < nbSpecs; i++)
+	{
+		nbLinks += specs[i].length;
+	}
+
+	m_Links.reserve(firstLink + nbLinks);
+	m_Joints.reserve(m_Joints.size() + nbLinks);
+
+	// 1. ũ. üθ  Ư ϳ, 絵     ϳ.
+	for (PxU32 i = 0; i < nbSpecs; i++)
+	{
+		const ChainSpec& spec = specs[i];
+		const PxU32 chainId = m_NextChainId++;
+
+		PxShape* shape = nullptr;
+
+		if (!spec.selfCollision)
+		{
+			shape = m_Physics.createShape(*spec.geometry, m_Material, false);
+			shape->setSimulationFilterData(PxFilterData(chainId, 0, 0, 0));
+		}
+
+		const PxMassProperties mass = PxMassProperties(*spec.geometry) * spec.density;
+		PxQuat massFrame;
+		const PxVec3 inertia = PxMassProperties::getMassSpaceInertia(mass.inertiaTensor, massFrame);
+		const PxTransform massPose(mass.centerOfMass, massFrame);
+
+		PxTransform localTm(PxVec3(spec.separation / 2, 0, 0));
+
+		for (PxU32 j = 0; j < spec.length; j++)
+		{
+			PxRigidDynamic* link = m_Physics.createRigidDynamic(spec.pose * localTm);
+
+			if (shape)
+			{
+				link->attachShape(*shape);
+			}
+			else
+			{
+				PxShape* linkShape = PxRigidActorExt::createExclusiveShape(*link, *spec.geometry, m_Material);
+				linkShape->setSimulationFilterData(PxFilterData(chainId, j + 1, 0, 0));
+			}
+
+			link->setMass(mass.mass);
+			link->setMassSpaceInertiaTensor(inertia);
+			link->setCMassLocalPose(massPose);
+			m_Links.push_back(link);
+			localTm.p.x += spec.separation;
+		}
+
+		// ũ   ִ.
+		if (shape)
+		{
+			shape->release();
+		}
+	}
+
+	// 2. Ʈ.  ũ Ƿ ü  Ѳ .
+	size_t link = firstLink;
+
+	for (PxU32 i = 0; i < nbSpecs; i++)
+	{
+		const ChainSpec& spec = specs[i];
+		const PxVec3 offset(spec.separation / 2, 0, 0);
+		PxRigidDynamic* prev = nullptr;
+
+		for (PxU32 j = 0; j < spec.length; j++)
+		{
+			PxRigidDynamic* curr = m_Links[link++];
+			m_Joints.push_back((*spec.createJoint)(prev, prev ? PxTransform(offset) : spec.pose, curr, PxTransform(-offset)));
+			prev = curr;
+		}
+	}
+
+	// 3.   ִ´.
+	if (nbLinks)
+	{
+		scene.addActors(reinterpret_cast<PxActor* const*>(&m_Links[firstLink]), nbLinks);
+	}
+}
+
+PxFilterFlags ChainBuilder::FilterShader(
+	PxFilterObjectAttributes attributes0, PxFilterData filterData0,
+	PxFilterObjectAttributes attributes1, PxFilterData filterData1,
+	PxPairFlags& pairFlags, const void*, PxU32)
+{
+	if (PxFilterObjectIsTrigger(attributes0) || PxFilterObjectIsTrigger(attributes1))
+	{
+		pairFlags = PxPairFlag::eTRIGGER_DEFAULT;
+		return PxFilterFlag::eDEFAULT;
+	}
+
+	//  üο ũ ȣ (  )  ,  ̿ ָ .
+	if (filterData0.word0 && filterData0.word0 == filterData1.word0)
+	{
+		const PxU32 a = filterData0.word1;
+		const PxU32 b = filterData1.word1;
+
+		if (!a || !b || a + 1 == b || b + 1 == a)
+		{
+			return PxFilterFlag::eKILL;
+		}
+	}
+
+	pairFlags = PxPairFlag::eCONTACT_DEFAULT;
+	return PxFilterFlag::eDEFAULT;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+
+/*
+	 ü ũ Ʈ    .
+
+	CreateChain  ũ PxCreateDynamic        addActor Ѵ.
+	ChainBuilder 
+		- üθ  ϳ   ũ  ,     Ѵ. (selfCollision ̸  ũ)
+		-  ũ   Ʈ Ѳ .
+		-  ũ addActors   ִ´.
+
+	ũ 浹 Ʈ 浹 ÷   ͷ . word0  ü ȣ .
+		- selfCollision     ü   Ƿ ũ   .
+		  FilterShader   üγ   .   ִ ª  üó ̿ ũ     .
+		- selfCollision    ũ   word1  ũ ȣ + 1  ִ´.
+		  FilterShader  ȣ 1   ̿ ָ Ƿ,  þ ü ڱ ڽŰ ε.
+	 ̵ ε  ,  ܰ迡 eKILL   ̴.
+	word0  0  (, ٴ ) ó 浹Ѵ.
+
+	
+		sceneDesc.filterShader = ChainBuilder::FilterShader;
+		ChainBuilder builder(physics, material);
+		ChainSpec specs[] = { ... };
+		builder.Build(scene, specs, 2);
+		builder.GetJoints() ...
+*/
+
+typedef physx::PxJoint* (*JointCreateFunction)(physx::PxRigidActor* a0, const physx::PxTransform& t0, physx::PxRigidActor* a1, const physx::PxTransform& t1);
+
+struct ChainSpec
+{
+	physx::PxTransform			pose;		// ù ũ 忡 ٴ ڸ. ü   x  ´.
+	physx::PxU32				length;
+	const physx::PxGeometry*	geometry;
+	physx::PxReal				separation;
+	physx::PxReal				density;
+	JointCreateFunction			createJoint;
+	bool						selfCollision;	// ̿ ƴ ũ 浹Ѵ.    ʴ´.
+};
+
+class ChainBuilder
+{
+public:
+	ChainBuilder(physx::PxPhysics& physics, physx::PxMaterial& material);
+
+	//  ũ Ʈ GetLinks / GetJoints ڿ ̾ ٴ´.
+	void Build(physx::PxScene& scene, const ChainSpec* specs, physx::PxU32 nbSpecs);
+
+	// ϸ . ü ״ ´.
+	void Clear() { m_Links.clear(); m_Joints.clear(); }
+
+	const std::vector<physx::PxRigidDynamic*>&	GetLinks() const { return m_Links; }
+	const std::vector<physx::PxJoint*>&			GetJoints() const { return m_Joints; }
+
+	static physx::PxFilterFlags FilterShader(
+		physx::PxFilterObjectAttributes attributes0, physx::PxFilterData filterData0,
+		physx::PxFilterObjectAttributes attributes1, physx::PxFilterData filterData1,
+		physx::PxPairFlags& pairFlags, const void* constantBlock, physx::PxU32 constantBlockSize);
+
+private:
+	physx::PxPhysics&	m_Physics;
+	physx::PxMaterial&	m_Material;
+	physx::PxU32		m_NextChainId;
+
+	std::vector<physx::PxRigidDynamic*>	m_Links;
+	std::vector<physx::PxJoint*>		m_Joints;
+};
@@ -1,12 +1,30 @@
 
+#include <algorithm>
 #include <ctype.h>
 #include <Windows.h>
+#include <vector>
 
 #include "PxPhysicsAPI.h"
 
 #include "SnippetPrint.h"
 #include "SnippetPVD.h"
 #include "SnippetUtils.h"
+#include "ConstraintTelemetry.h"
+#include "BrokenConstraintHandler.h"
+#include "ArticulationChain.h"
+#include "ChainBuilder.h"
+
+// 1̸   Ʈ 2       ûũ    Ѵ.
+#define JOINT_TELEMETRY_BENCHMARK 0
+
+// 1̸  ü Ʈ  Ƽŧ̼ .
+#define ARTICULATION_CHAINS 0
+
+// 1̸   ü  5~1000  Ʈ üΰ Ƽŧ̼ ü  ð, ʿ ݺ Ƚ, þ Ѵ.
+#define CHAIN_BENCHMARK 0
+
+// 1̸   100 ũ ü 500 (Ʈ 5 ) CreateChain    ChainBuilder    Ѵ.
+#define BULK_CHAIN_BENCHMARK 0
 
 using namespace physx;
 
@@ -23,6 +41,21 @@ PxMaterial* gMaterial = NULL;
 
 PxPvd* gPvd = NULL;
 
+//  ü Ʈ . Ʈ Ʒ Ѱ踦 (stress 1) ĥѴ.
+ConstraintTelemetry gTelemetry;
+
+const PxReal gJointForceLimit = 1000.0f;
+const PxReal gJointTorqueLimit = 10000.0f;
+
+//  Ʈ Ѱ踦 ̸ŭ   ´.
+const PxU32 gFatigueFrames = 5;
+
+//   Ѱ    ٸ ʰ SDK  ´.
+const PxReal gJointBreakScale = 10.0f;
+
+// SDK   Ͱ ApplyBreakPolicy     fetchResults ڿ   Ѵ.
+BrokenConstraintHandler gBreakHandler;
+
 //  
 PxRigidDynamic* CreateDynamic(const PxTransform& t, const PxGeometry& geometry,
     const PxVec3& velocity = PxVec3(0))
@@ -50,8 +83,9 @@ PxJoint* CreateLimitedSpherical(PxRigidActor* a0, const PxTransform& t0,
 PxJoint* CreateBreakableFixed(PxRigidActor* a0, const PxTransform& t0,
     PxRigidActor* a1, const PxTransform& t1)
 {
+    // ӵǴ ϴ ApplyBreakPolicy  ڷƮ  , breakForce   ݸ ô´.
     PxFixedJoint* joint = PxFixedJointCreate(*gPhysics, a0, t0, a1, t1);
-    joint->setBreakForce(1000, 10000);
+    joint->setBreakForce(gJointForceLimit * gJointBreakScale, gJointTorqueLimit * gJointBreakScale);
     //  Ѱ踦 impulses Force 
     joint->setConstraintFlag(PxConstraintFlag::eDRIVE_LIMITS_ARE_FORCES, true);
     joint->setConstraintFlag(PxConstraintFlag::eDISABLE_PREPROCESSING, true);
@@ -73,10 +107,8 @@ PxJoint* CreateDampedD6(PxRigidActor* a0, const PxTransform& t0,
     return joint;
 }
 
-typedef PxJoint* (*JointCreateFunction)(PxRigidActor* a0, const PxTransform& t0, PxRigidActor* a1, const PxTransform& t1);
-
 void CreateChain(const PxTransform& t, PxU32 length, const PxGeometry& g,
-    PxReal separation, JointCreateFunction createJoint)
+    PxReal separation, JointCreateFunction createJoint, std::vector<PxRigidBody*>* links = nullptr)
 {
     PxVec3 offset(separation/2, 0, 0);
     PxTransform localTm(offset);
@@ -85,8 +117,11 @@ void CreateChain(const PxTransform& t, PxU32 length, const PxGeometry& g,
     for (PxU32 i = 0; i < length; i++)
     {
         PxRigidBody* currRigid = PxCreateDynamic(*gPhysics, t * localTm, g, *gMaterial, 1.0f);
-        (*createJoint)(prev, prev ? PxTransform(offset) : t, currRigid, PxTransform(-offset));
+        PxJoint* joint = (*createJoint)(prev, prev ? PxTransform(offset) : t, currRigid, PxTransform(-offset));
+        gTelemetry.Add(*joint->getConstraint(), gJointForceLimit, gJointTorqueLimit, joint);
         gScene->addActor(*currRigid);
+        if (links)
+            links->push_back(currRigid);
         prev = currRigid;
         localTm.p.x += separation;
     }
@@ -109,7 +144,8 @@ void InitPhysics(bool)
     PxSceneDesc sceneDesc(gPhysics->getTolerancesScale());
     sceneDesc.gravity = PxVec3(0, 9.8f, 0);
     sceneDesc.cpuDispatcher = gDispatcher;
-    sceneDesc.filterShader = PxDefaultSimulationFilterShader;
+    sceneDesc.filterShader = ChainBuilder::FilterShader;
+    sceneDesc.simulationEventCallback = &gBreakHandler;
     
     gScene = gPhysics->createScene(sceneDesc);
 
@@ -126,20 +162,71 @@ void InitPhysics(bool)
     PxRigidStatic* ground = PxCreatePlane(*gPhysics, PxPlane(0, 1, 0, 0), *gMaterial);
 
     gScene->addActor(*ground);
+
+    gTelemetry.Init(*gDispatcher);
+
     PxBoxGeometry barGeometry(2.0f, 0.5f, 0.5f);
-    CreateChain(PxTransform(PxVec3(0.0f, 20.0f, 0.0f)), 5, barGeometry, 4.0f, CreateLimitedSpherical);
-    CreateChain(PxTransform(PxVec3(0.0f, 20.0f, -10.0f)), 5, barGeometry, 4.0f, CreateBreakableFixed);
-    CreateChain(PxTransform(PxVec3(0.0f, 20.0f, -20.0f)), 5, barGeometry, 4.0f, CreateDampedD6);
+#if ARTICULATION_CHAINS
+    ArticulationChain chains[3];
+    CreateArticulationChain(*gPhysics, *gScene, *gMaterial, PxTransform(PxVec3(0.0f, 20.0f, 0.0f)), 5, barGeometry, 4.0f, SetupLimitedSpherical, CreateLimitedSpherical, chains[0]);
+    CreateArticulationChain(*gPhysics, *gScene, *gMaterial, PxTransform(PxVec3(0.0f, 20.0f, -10.0f)), 5, barGeometry, 4.0f, SetupFixed, CreateBreakableFixed, chains[1]);
+    CreateArticulationChain(*gPhysics, *gScene, *gMaterial, PxTransform(PxVec3(0.0f, 20.0f, -20.0f)), 5, barGeometry, 4.0f, SetupDampedD6, CreateDampedD6, chains[2]);
+#else
+    const ChainSpec specs[] =
+    {
+        { PxTransform(PxVec3(0.0f, 20.0f, 0.0f)), 5, &barGeometry, 4.0f, 1.0f, CreateLimitedSpherical, false },
+        { PxTransform(PxVec3(0.0f, 20.0f, -10.0f)), 5, &barGeometry, 4.0f, 1.0f, CreateBreakableFixed, false },
+        { PxTransform(PxVec3(0.0f, 20.0f, -20.0f)), 5, &barGeometry, 4.0f, 1.0f, CreateDampedD6, false },
+    };
+
+    ChainBuilder builder(*gPhysics, *gMaterial);
+    builder.Build(*gScene, specs, 3);
+    for (PxJoint* joint : builder.GetJoints())
+        gTelemetry.Add(*joint->getConstraint(), gJointForceLimit, gJointTorqueLimit, joint);
+#endif
+}
+
+// Ѱ踦 gFatigueFrames  ѱ  Ʈ ´.
+// SDK   Ʈ Բ ڷƮ ,  gBreakHandler  ñ.
+void ApplyBreakPolicy()
+{
+    // صδ  Remove    ̴.
+    std::vector<PxU32> indices(gTelemetry.GetBroken());
+
+    for (PxU32 index : gTelemetry.GetOverloaded())
+    {
+        PxJoint* joint = static_cast<PxJoint*>(gTelemetry.GetUserData(index));
+
+        // óⰡ  (eKEEP) Ʈ  Ƿ ڷƮ .
+        if (joint->getConcreteType() == PxJointConcreteType::eFIXED && gTelemetry.GetOverloadFrames(index) >= gFatigueFrames
+            && gBreakHandler.Add(*joint->getConstraint()))
+        {
+            indices.push_back(index);
+        }
+    }
+
+    // Remove   Ҹ űǷ ū ε .
+    std::sort(indices.begin(), indices.end(), [](PxU32 a, PxU32 b) { return a > b; });
+
+    for (PxU32 index : indices)
+    {
+        gTelemetry.Remove(index);
+    }
 }
 
 void StepPhysics(bool)
 {
     gScene->simulate(1.0f / 60.0f);
     gScene->fetchResults(true);
+
+    gTelemetry.Gather();
+    ApplyBreakPolicy();
+    gBreakHandler.Process();
 }
 
 void CleanupPhysics(bool)
 {
+    gTelemetry.Release();
     PX_RELEASE(gScene);
     PX_RELEASE(gDispatcher);
     PxCloseExtensions();
@@ -152,6 +239,8 @@ void CleanupPhysics(bool)
     }
     PX_RELEASE(gFoundation);
 
+    // Ӻ  gBreakHandler.GetNbProcessed() / GetHistory()  д´.
+    printf("%llu joints broke.\n", (unsigned long long)gBreakHandler.GetTotalProcessed());
     printf("SnippetJoint done.\n");
 }
 
@@ -163,9 +252,285 @@ void KeyPress(unsigned char key, const PxTransform& camera)
     }
 }
 
+void RunTelemetryBenchmark()
+{
+    const PxU32 nbChains = 200;
+    const PxU32 chainLength = 100;
+    const PxU32 warmUpFrames = 30;
+    const PxU32 frames = 100;
+    const char* modeNames[2] = { "serial", "parallel" };
+    PxReal gatherMs[2] = {};
+    PxReal maxStress[2] = {};
+    PxU32 nbJoints = 0;
+
+    // 帶      .  ӿ Gather    ƾ
+    //  尡   ĳø  尡  ʰ,   Ƚ    ʴ´.
+    for (PxU32 mode = 0; mode < 2; mode++)
+    {
+        InitPhysics(false);
+
+        PxBoxGeometry barGeometry(2.0f, 0.5f, 0.5f);
+        for (PxU32 i = 0; i < nbChains; i++)
+        {
+            CreateChain(PxTransform(PxVec3(0.0f, 40.0f, -30.0f - 3.0f * PxReal(i))), chainLength, barGeometry, 4.0f, CreateLimitedSpherical);
+        }
+
+        nbJoints = gTelemetry.GetNbConstraints();
+
+        for (PxU32 i = 0; i < warmUpFrames + frames; i++)
+        {
+            gScene->simulate(1.0f / 60.0f);
+            gScene->fetchResults(true);
+
+            gTelemetry.Gather(mode == 1);
+
+            if (i >= warmUpFrames)
+            {
+                gatherMs[mode] += gTelemetry.GetLastGatherMilliseconds();
+            }
+        }
+
+        maxStress[mode] = gTelemetry.GetMaxStress();
+        CleanupPhysics(false);
+    }
+
+    printf("%u joints, %u frames, chunk %u\n", nbJoints, frames, ConstraintTelemetry::CHUNK_SIZE);
+    printf("%-10s %10s %12s %12s\n", "mode", "gather ms", "ns / joint", "max stress");
+
+    for (PxU32 mode = 0; mode < 2; mode++)
+    {
+        printf("%-10s %10.3f %12.1f %12.3f\n", modeNames[mode], gatherMs[mode] / frames, gatherMs[mode] * 1.0e6f / (frames * PxReal(nbJoints)), maxStress[mode]);
+    }
+}
+
+enum ChainBackend
+{
+    eCHAIN_JOINTS,
+    eCHAIN_ARTICULATION,
+};
+
+struct ChainMeasurement
+{
+    PxReal stepMs;
+    PxReal avgGap;  // ̿ ũ Ʈ ڸ  Ÿ.  
+    PxReal maxGap;  //    ִ
+};
+
+const PxReal gChainSeparation = 4.0f;
+const PxReal gChainGapTolerance = 0.01f * gChainSeparation;
+const PxU32 gChainBenchmarkFrames = 120;
+
+void MeasureChainGaps(const PxTransform& t, const std::vector<PxRigidBody*>& links, PxReal& avgGap, PxReal& maxGap)
+{
+    const PxVec3 offset(gChainSeparation / 2, 0, 0);
+    PxVec3 prevJoint = t.p;
+    PxReal sum = 0.0f;
+    maxGap = 0.0f;
+
+    for (PxRigidBody* link : links)
+    {
+        const PxTransform pose = link->getGlobalPose();
+        const PxReal gap = (pose.transform(-offset) - prevJoint).magnitude();
+        sum += gap;
+        maxGap = PxMax(maxGap, gap);
+        prevJoint = pose.transform(offset);
+    }
+
+    avgGap = sum / PxReal(links.size());
+}
+
+// ġũ  . ٴ .
+void RecreateScene(PxSimulationFilterShader filterShader)
+{
+    gTelemetry.Clear();
+    PX_RELEASE(gScene);
+
+    PxSceneDesc sceneDesc(gPhysics->getTolerancesScale());
+    sceneDesc.gravity = PxVec3(0.0f, -9.81f, 0.0f);
+    sceneDesc.cpuDispatcher = gDispatcher;
+    sceneDesc.filterShader = filterShader;
+    gScene = gPhysics->createScene(sceneDesc);
+}
+
+// ڷƮ ϵ Ʈ  .
+void ReleaseTelemetryJoints()
+{
+    for (PxU32 i = 0; i < gTelemetry.GetNbConstraints(); i++)
+        static_cast<PxJoint*>(gTelemetry.GetUserData(i))->release();
+    gTelemetry.Clear();
+}
+
+//   ü   Ŵ޷   .
+ChainMeasurement MeasureChain(ChainBackend backend, PxU32 length, PxU32 positionIterations)
+{
+    RecreateScene(PxDefaultSimulationFilterShader);
+
+    const PxTransform t(PxVec3(0.0f, 20.0f, 0.0f));
+    const PxBoxGeometry barGeometry(2.0f, 0.5f, 0.5f);
+
+    std::vector<PxRigidBody*> links;
+    ArticulationChain chain;
+
+    if (backend == eCHAIN_JOINTS)
+    {
+        CreateChain(t, length, barGeometry, gChainSeparation, CreateLimitedSpherical, &links);
+        for (PxRigidBody* link : links)
+            link->is<PxRigidDynamic>()->setSolverIterationCounts(positionIterations, 1);
+    }
+    else
+    {
+        CreateArticulationChain(*gPhysics, *gScene, *gMaterial, t, length, barGeometry, gChainSeparation, SetupLimitedSpherical, CreateLimitedSpherical, chain);
+        chain.SetSolverIterationCounts(positionIterations, 1);
+        links = chain.links;
+    }
+
+    ChainMeasurement result = { 0.0f, 0.0f, 0.0f };
+    PxU64 ticks = 0;
+
+    for (PxU32 i = 0; i < gChainBenchmarkFrames; i++)
+    {
+        const PxU64 start = SnippetUtils::getCurrentTimeCounterValue();
+        gScene->simulate(1.0f / 60.0f);
+        gScene->fetchResults(true);
+        ticks += SnippetUtils::getCurrentTimeCounterValue() - start;
+
+        PxReal avgGap, maxGap;
+        MeasureChainGaps(t, links, avgGap, maxGap);
+        result.avgGap += avgGap / PxReal(gChainBenchmarkFrames);
+        result.maxGap = PxMax(result.maxGap, maxGap);
+    }
+
+    result.stepMs = SnippetUtils::getElapsedTimeInMilliseconds(ticks) / PxReal(gChainBenchmarkFrames);
+
+    // ̿ ݺ Ƚ  Ƿ ٷ .
+    ReleaseTelemetryJoints();
+
+    if (backend == eCHAIN_JOINTS)
+    {
+        for (PxRigidBody* link : links)
+            link->release();
+    }
+
+    chain.Release();
+    return result;
+}
+
+void RunChainBenchmark()
+{
+    InitPhysics(false);
+
+    const PxU32 lengths[] = { 5, 10, 50, 100, 250, 500, 1000 };
+    const PxU32 iterations[] = { 4, 8, 16, 32, 64, 128, 255 };
+    const char* backendNames[] = { "joints", "articulation" };
+
+    printf("limited spherical chains, %u frames, gap tolerance %.3f\n", gChainBenchmarkFrames, gChainGapTolerance);
+    printf("%-6s %-13s %10s %10s %10s %8s %12s\n", "links", "backend", "ms (4 it)", "avg gap", "max gap", "iters", "ms (iters)");
+
+    for (PxU32 length : lengths)
+    {
+        for (PxU32 backend = eCHAIN_JOINTS; backend <= eCHAIN_ARTICULATION; backend++)
+        {
+            const ChainMeasurement base = MeasureChain(ChainBackend(backend), length, iterations[0]);
+
+            // ִ  ġ ȿ    ġ ݺ Ƚ.
+            PxU32 needed = 0;
+            PxReal neededMs = 0.0f;
+
+            for (PxU32 it : iterations)
+            {
+                const ChainMeasurement m = it == iterations[0] ? base : MeasureChain(ChainBackend(backend), length, it);
+                if (m.maxGap <= gChainGapTolerance)
+                {
+                    needed = it;
+                    neededMs = m.stepMs;
+                    break;
+                }
+            }
+
+            if (needed)
+                printf("%-6u %-13s %10.3f %10.4f %10.4f %8u %12.3f\n", length, backendNames[backend], base.stepMs, base.avgGap, base.maxGap, needed, neededMs);
+            else
+                printf("%-6u %-13s %10.3f %10.4f %10.4f %8s %12s\n", length, backendNames[backend], base.stepMs, base.avgGap, base.maxGap, "> 255", "-");
+        }
+    }
+
+    CleanupPhysics(false);
+}
+
+// ü 500     ù ܱ .   .
+void MeasureBulkChains(bool bulk, PxReal& buildMs, PxReal& firstStepMs)
+{
+    const PxU32 nbChains = 500;
+    const PxU32 chainLength = 100;
+
+    RecreateScene(ChainBuilder::FilterShader);
+
+    const PxBoxGeometry barGeometry(2.0f, 0.5f, 0.5f);
+    std::vector<PxRigidBody*> links;
+    links.reserve(nbChains * chainLength);
+
+    PxU64 start = SnippetUtils::getCurrentTimeCounterValue();
+
+    if (bulk)
+    {
+        std::vector<ChainSpec> specs(nbChains);
+        for (PxU32 i = 0; i < nbChains; i++)
+            specs[i] = { PxTransform(PxVec3(0.0f, 40.0f, -3.0f * PxReal(i))), chainLength, &barGeometry, gChainSeparation, 1.0f, CreateLimitedSpherical, false };
+
+        ChainBuilder builder(*gPhysics, *gMaterial);
+        builder.Build(*gScene, specs.data(), nbChains);
+
+        for (PxJoint* joint : builder.GetJoints())
+            gTelemetry.Add(*joint->getConstraint(), gJointForceLimit, gJointTorqueLimit, joint);
+        links.assign(builder.GetLinks().begin(), builder.GetLinks().end());
+    }
+    else
+    {
+        for (PxU32 i = 0; i < nbChains; i++)
+            CreateChain(PxTransform(PxVec3(0.0f, 40.0f, -3.0f * PxReal(i))), chainLength, barGeometry, gChainSeparation, CreateLimitedSpherical, &links);
+    }
+
+    buildMs = SnippetUtils::getElapsedTimeInMilliseconds(SnippetUtils::getCurrentTimeCounterValue() - start);
+
+    // ù ܿ ε ְ Ϸ尡 .
+    start = SnippetUtils::getCurrentTimeCounterValue();
+    gScene->simulate(1.0f / 60.0f);
+    gScene->fetchResults(true);
+    firstStepMs = SnippetUtils::getElapsedTimeInMilliseconds(SnippetUtils::getCurrentTimeCounterValue() - start);
+
+    ReleaseTelemetryJoints();
+    for (PxRigidBody* link : links)
+        link->release();
+}
+
+void RunBulkChainBenchmark()
+{
+    InitPhysics(false);
+
+    const char* modeNames[] = { "per link", "bulk" };
+
+    printf("500 chains x 100 links\n");
+    printf("%-10s %10s %14s\n", "mode", "build ms", "first step ms");
+
+    for (PxU32 bulk = 0; bulk < 2; bulk++)
+    {
+        PxReal buildMs, firstStepMs;
+        MeasureBulkChains(bulk != 0, buildMs, firstStepMs);
+        printf("%-10s %10.3f %14.3f\n", modeNames[bulk], buildMs, firstStepMs);
+    }
+
+    CleanupPhysics(false);
+}
+
 int SnippetMain(int, const char* const*)
 {
-#ifdef RENDER_SNIPPET
+#if JOINT_TELEMETRY_BENCHMARK
+    RunTelemetryBenchmark();
+#elif CHAIN_BENCHMARK
+    RunChainBenchmark();
+#elif BULK_CHAIN_BENCHMARK
+    RunBulkChainBenchmark();
+#elif defined(RENDER_SNIPPET)
     extern void RenderLoop();
     RenderLoop();
 #else
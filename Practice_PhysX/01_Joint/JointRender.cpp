@@ -1,11 +1,13 @@
 #ifdef RENDER_SNIPPET
 
+#include <unordered_map>
 #include <vector>
 
 #include "PxPhysicsAPI.h"
 
 #include "SnippetRender.h"
 #include "SnippetCamera.h"
+#include "ConstraintTelemetry.h"
 
 using namespace physx;
 
@@ -14,6 +16,8 @@ extern void StepPhysics(bool interactive);
 extern void CleanupPhysics(bool interactive);
 extern void KeyPress(unsigned char key, const PxTransform& camera);
 
+extern ConstraintTelemetry gTelemetry;
+
 namespace
 {
 	Snippets::Camera* sCamera;
@@ -42,6 +46,62 @@ namespace
 		glutPostRedisplay();
 	}
 
+	// Ʈ ɸ ٵ stress  ĥѴ. ʷ(0) -> (1 ̻)
+	void RenderStressHeatMap(PxScene& scene)
+	{
+		std::unordered_map<PxRigidActor*, PxReal> stress;
+
+		for (PxU32 i = 0; i < gTelemetry.GetNbConstraints(); i++)
+		{
+			PxRigidActor* actors[2];
+			gTelemetry.GetConstraint(i)->getActors(actors[0], actors[1]);
+
+			for (PxRigidActor* actor : actors)
+			{
+				if (actor)
+				{
+					PxReal& value = stress[actor];
+					value = PxMax(value, gTelemetry.GetStress(i));
+				}
+			}
+		}
+
+		PxU32 nbActors = scene.getNbActors(PxActorTypeFlag::eRIGID_DYNAMIC | PxActorTypeFlag::eRIGID_STATIC);
+		std::vector<PxRigidActor*> actors(nbActors);
+		if (nbActors)
+			scene.getActors(PxActorTypeFlag::eRIGID_DYNAMIC | PxActorTypeFlag::eRIGID_STATIC, reinterpret_cast<PxActor**>(&actors[0]), nbActors);
+
+		// Ƽŧ̼ ũ getActors   ʴ´.
+		PxU32 nbArticulations = scene.getNbArticulations();
+		for (PxU32 i = 0; i < nbArticulations; i++)
+		{
+			PxArticulationBase* articulation;
+			scene.getArticulations(&articulation, 1, i);
+
+			const PxU32 nbLinks = articulation->getNbLinks();
+			std::vector<PxArticulationLink*> links(nbLinks);
+			articulation->getLinks(&links[0], nbLinks);
+			actors.insert(actors.end(), links.begin(), links.end());
+		}
+
+		std::vector<PxRigidActor*> others;
+		for (PxRigidActor* actor : actors)
+		{
+			auto it = stress.find(actor);
+			if (it == stress.end())
+			{
+				others.push_back(actor);
+				continue;
+			}
+
+			const PxReal t = PxMin(it->second, 1.0f);
+			Snippets::renderActors(&actor, 1, true, PxVec3(t, 0.75f * (1.0f - t), 0.0f));
+		}
+
+		if (!others.empty())
+			Snippets::renderActors(&others[0], static_cast<PxU32>(others.size()), true);
+	}
+
 	void RenderCallback()
 	{
 		StepPhysics(true);
@@ -50,13 +110,7 @@ namespace
 
 		PxScene* scene;
 		PxGetPhysics().getScenes(&scene, 1);
-		PxU32 nbActors = scene->getNbActors(PxActorTypeFlag::eRIGID_DYNAMIC | PxActorTypeFlag::eRIGID_STATIC);
-		if (nbActors)
-		{
-			std::vector<PxRigidActor*> actors(nbActors);
-			scene->getActors(PxActorTypeFlag::eRIGID_DYNAMIC | PxActorTypeFlag::eRIGID_STATIC, reinterpret_cast<PxActor**>(&actors[0]), nbActors);
-			Snippets::renderActors(&actors[0], static_cast<PxU32>(actors.size()), true);
-		}
+		RenderStressHeatMap(*scene);
 
 		Snippets::finishRender();
 	}
@@ -17,6 +17,10 @@ to scene to handle such cases.*/
 #include "SnippetPrint.h"
 #include "SnippetPVD.h"
 
+#include "BroadPhaseRegionManager.h"
+#include "OutOfBoundsHandler.h"
+#include "OriginShiftManager.h"
+
 
 using namespace physx;
 
@@ -35,7 +39,23 @@ PxPvd* gPvd = NULL;
 
 PxReal stackZ = 10.0f;
 
-PxU32 gRegionHandles[4];
+//  з ±. gBroadPhaseCallback  ȴ.
+enum ActorTag
+{
+	ACTOR_TAG_DEFAULT = 0,
+	ACTOR_TAG_BALL,
+};
+
+// ٿ   ͵ ±׺ å óѴ.
+OutOfBoundsHandler gBroadPhaseCallback;
+
+//  4     ٿ   е  ų ģ.
+BroadPhaseRegionManager gRegionManager;
+
+//   ־   ű.  忡 ī޶ ġ, ƴϸ ú ġ .
+OriginShiftManager gOriginShiftManager;
+PxVec3 gOriginFocus(0.0f);
+PxRigidDynamic* gFocusBall = nullptr;
 
 //ú .
 PxRigidDynamic* CreateDynamic(const PxTransform& t, const PxGeometry& geometry, const PxVec3& velocity = PxVec3(0))
@@ -58,6 +78,7 @@ PxRigidDynamic* CreateDynamic(const PxTransform& t, const PxGeometry& geometry,
 	ball->setAngularDamping(0.5f);
 	ball->setLinearVelocity(velocity);
 	ball->setName("Ball");
+	gBroadPhaseCallback.SetActorTag(*ball, ACTOR_TAG_BALL);
 	gScene->addActor(*ball);
 	return ball;
 }
@@ -79,53 +100,6 @@ void CreateStack(const PxTransform& t, PxU32 size, PxReal halfExtent)
 	shape->release();
 }
 
-class SnippetMBPBroadPhaseCallback : public physx::PxBroadPhaseCallback
-{
-public:
-	virtual ~SnippetMBPBroadPhaseCallback() = default;
-
-	virtual	void onObjectOutOfBounds(PxShape& shape, PxActor& actor) override
-	{
-		if (actor.getName() != "Ball")
-		{
-			bool isNoneOverlapActor = true;
-			for (auto& it : m_OutActors)
-			{
-				if (it == &actor)
-				{
-					isNoneOverlapActor = false;
-					break;
-				}
-			}
-
-			if (isNoneOverlapActor)
-			{
-				m_OutActors.push_back(&actor);
-			}
-		}
-	}
-
-	virtual	void onObjectOutOfBounds(PxAggregate& aggregate) override
-	{
-		
-	}
-
-	void PurgeOutActors()
-	{
-		for (auto& it : m_OutActors)
-		{
-			it->release();
-		}
-
-		m_OutActors.clear();
-	}
-
-private:
-	std::vector<PxActor*> m_OutActors;
-
-} gBroadPhaseCallback;
-
-
 void InitPhysics(bool interactive)
 {
 	gFoundation = PxCreateFoundation(PX_PHYSICS_VERSION, gAllocator, gErrorCallback);
@@ -150,21 +124,12 @@ void InitPhysics(bool interactive)
 	sceneDesc.broadPhaseType = PxBroadPhaseType::eMBP;
 	sceneDesc.broadPhaseCallback = &gBroadPhaseCallback;
 
-	gScene = gPhysics->createScene(sceneDesc);
-
-	//  .
-	PxBroadPhaseRegion regions[4] =
-	{
-		{	PxBounds3(PxVec3(-100, -100, -100),  PxVec3(0, 100,   0)), reinterpret_cast<void*>(1) },
-		{	PxBounds3(PxVec3(-100, -100,    0),  PxVec3(0, 100, 100)), reinterpret_cast<void*>(2) },
-		{	PxBounds3(PxVec3(0, -100, -100),  PxVec3(100, 100,   0)), reinterpret_cast<void*>(3) },
-		{	PxBounds3(PxVec3(0, -100,    0),  PxVec3(100, 100, 100)), reinterpret_cast<void*>(4) }
-	};
+	//  ڵ ٿ带  ϰ, ú    ùķ̼Ѵ.
+	gBroadPhaseCallback.SetPolicy(ACTOR_TAG_DEFAULT, OutOfBoundsPolicy::eRELEASE);
+	gBroadPhaseCallback.SetPolicy(ACTOR_TAG_BALL, OutOfBoundsPolicy::eSWITCH_REGION);
+	gBroadPhaseCallback.SetRegionManager(&gRegionManager);
 
-	for (auto& it : regions)
-	{
-		gScene->addBroadPhaseRegion(it);
-	}
+	gScene = gPhysics->createScene(sceneDesc);
 
 	PxPvdSceneClient* pvdClient = gScene->getScenePvdClient();
 	if (pvdClient)
@@ -187,21 +152,51 @@ void InitPhysics(bool interactive)
 
 	if (!interactive)
 	{
-		CreateDynamic(PxTransform(PxVec3(0, 40, 100)), PxSphereGeometry(10), PxVec3(0, -50, -100));
+		gFocusBall = CreateDynamic(PxTransform(PxVec3(0, 40, 100)), PxSphereGeometry(10), PxVec3(0, -50, -100));
 	}
+
+	// ͵   ڿ  ٿκ  ڸ .
+	BroadPhaseRegionManager::Desc regionDesc;
+	regionDesc.nbSubdiv = 2;
+	regionDesc.maxObjectsPerRegion = 64;
+	regionDesc.minObjectsPerRegion = 8;
+	gRegionManager.Init(*gScene, regionDesc);
+
+	//  尡 Ƿ Ӱ谪 ۰ ´.    km   ȴ.
+	OriginShiftManager::Desc shiftDesc;
+	shiftDesc.threshold = 100.0f;
+	shiftDesc.gridSize = 50.0f;
+	gOriginShiftManager.Init(*gScene, shiftDesc);
+	gOriginShiftManager.AddListener(&gRegionManager);
+	gOriginShiftManager.AddListener(&gBroadPhaseCallback);
 }
 
-void StepPhysics(bool)
+void StepPhysics(bool interactive)
 {
 	gScene->simulate(1 / 60.0f);
 	gScene->fetchResults(true);
 
-	// ٿ   ͵  .
-	gBroadPhaseCallback.PurgeOutActors();
+	// ٿ   ͵ å   ó.
+	gBroadPhaseCallback.Process(*gScene);
+
+	// ٿ  ̺Ʈ  Ʈ    ٽ .
+	gRegionManager.Update();
+
+	const PxVec3 focus = interactive || !gFocusBall ? gOriginFocus : gFocusBall->getGlobalPose().p;
+
+	if (gOriginShiftManager.Update(focus))
+	{
+		const PxVec3& origin = gOriginShiftManager.GetOrigin();
+		printf("origin shifted to (%.1f, %.1f, %.1f) : scene %.3fms, listeners %.3fms\n", origin.x, origin.y, origin.z,
+			gOriginShiftManager.GetLastSceneMilliseconds(), gOriginShiftManager.GetLastListenerMilliseconds());
+	}
 }
 
 void CleanupPhysics(bool)
 {
+	gBroadPhaseCallback.Release();
+	gOriginShiftManager.Release();
+	gRegionManager.Release();
 	PX_RELEASE(gScene);
 	PX_RELEASE(gDispatcher);
 	PX_RELEASE(gPhysics);
@@ -232,10 +227,10 @@ int SnippetMain(int, const char* const*)
 	RenderLoop();
 #else
 	static const PxU32 frameCount = 100;
-	initPhysics(false);
+	InitPhysics(false);
 	for (PxU32 i = 0; i < frameCount; i++)
-		stepPhysics(false);
-	cleanupPhysics(false);
+		StepPhysics(false);
+	CleanupPhysics(false);
 #endif
 
 	return 0;
@@ -7,6 +7,9 @@
 #include "SnippetRender.h"
 #include "SnippetCamera.h"
 
+#include "BroadPhaseRegionManager.h"
+#include "OriginShiftManager.h"
+
 using namespace physx;
 
 extern void InitPhysics(bool interactive);
@@ -14,10 +17,67 @@ extern void StepPhysics(bool interactive);
 extern void CleanupPhysics(bool interactive);
 extern void KeyPress(unsigned char key, const PxTransform& camera);
 
+extern BroadPhaseRegionManager gRegionManager;
+extern OriginShiftManager gOriginShiftManager;
+extern PxVec3 gOriginFocus;
+
 namespace
 {
 	Snippets::Camera* sCamera;
 
+	//  Ű ī޶  Űܾ ȭ Ƣ ʴ´.
+	class CameraShiftListener : public OriginShiftListener
+	{
+	public:
+		virtual void OnOriginShift(const PxVec3& shift) override
+		{
+			*sCamera = Snippets::Camera(sCamera->getEye() - shift, sCamera->getDir());
+		}
+	};
+
+	CameraShiftListener sCameraShiftListener;
+
+	std::vector<PxBounds3>	sRegionBounds;
+	std::vector<PxVec3>		sRegionLines;
+
+	//   ̾ ڽ ׸.
+	void RenderRegions()
+	{
+		gRegionManager.GetRegionBounds(sRegionBounds);
+
+		sRegionLines.clear();
+
+		for (auto& it : sRegionBounds)
+		{
+			const PxVec3& a = it.minimum;
+			const PxVec3& b = it.maximum;
+
+			const PxVec3 corners[8] =
+			{
+				PxVec3(a.x, a.y, a.z), PxVec3(b.x, a.y, a.z), PxVec3(b.x, b.y, a.z), PxVec3(a.x, b.y, a.z),
+				PxVec3(a.x, a.y, b.z), PxVec3(b.x, a.y, b.z), PxVec3(b.x, b.y, b.z), PxVec3(a.x, b.y, b.z)
+			};
+
+			const PxU32 edges[24] = { 0,1, 1,2, 2,3, 3,0, 4,5, 5,6, 6,7, 7,4, 0,4, 1,5, 2,6, 3,7 };
+
+			for (auto& e : edges)
+			{
+				sRegionLines.push_back(corners[e]);
+			}
+		}
+
+		if (sRegionLines.size())
+		{
+			glDisable(GL_LIGHTING);
+			glColor4f(1.0f, 1.0f, 0.0f, 1.0f);
+			glEnableClientState(GL_VERTEX_ARRAY);
+			glVertexPointer(3, GL_FLOAT, 0, &sRegionLines[0]);
+			glDrawArrays(GL_LINES, 0, GLint(sRegionLines.size()));
+			glDisableClientState(GL_VERTEX_ARRAY);
+			glEnable(GL_LIGHTING);
+		}
+	}
+
 	void MotionCallback(int x, int y)
 	{
 		sCamera->handleMotion(x, y);
@@ -44,6 +104,7 @@ namespace
 
 	void RenderCallback()
 	{
+		gOriginFocus = sCamera->getEye();
 		StepPhysics(true);
 
 		Snippets::startRender(sCamera->getEye(), sCamera->getDir());
@@ -58,6 +119,8 @@ namespace
 			Snippets::renderActors(&actors[0], static_cast<PxU32>(actors.size()), true);
 		}
 
+		RenderRegions();
+
 		Snippets::finishRender();
 	}
 
@@ -85,6 +148,7 @@ void RenderLoop()
 	atexit(ExitCallback);
 
 	InitPhysics(true);
+	gOriginShiftManager.AddListener(&sCameraShiftListener);
 	glutMainLoop();
 }
 #endif
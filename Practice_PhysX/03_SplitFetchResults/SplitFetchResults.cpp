@@ -13,11 +13,32 @@ impulse.*/
 #include "SnippetPrint.h"
 #include "SnippetPVD.h"
 #include "SnippetUtils.h"
-#include "task/PxTask.h"
-#include <atomic>
+#include "SceneTuning.h"
+#include "ContactBuffer.h"
+#include "ContactReportPolicy.h"
+#include "ContactRecorder.h"
+#include "ContactExtractor.h"
+#include "ContactAggregator.h"
+#include "TaskChain.h"
 
 #define PARALLEL_CALLBACKS 1
 
+// 1̸   Ʈϴ  ̴ ContactReportPolicy   
+// Ʈ Ʈ ũ ݹ ð Ѵ.
+#define CONTACT_REPORT_BENCHMARK 0
+
+// 1̸ extractContacts(AoS, 64 )     İ ContactExtractor 
+//  Ʈ     ð Ѵ.
+#define CONTACT_EXTRACT_BENCHMARK 0
+
+// 1̸ Ʈ  Ϸ Ѵ.   ϸ    ٽ о  Ѵ.
+#define RECORD_CONTACT_LOG 0
+#define CONTACT_LOG_PATH "SplitFetchResults.clog"
+
+//    ̹  ִ 뷮 ؼ ϰ,
+//  createScene  ؼ ۸ ̸ ҴѴ.
+#define SCENE_TUNING_PROFILE "SplitFetchResults.tuning"
+
 using namespace physx;
 
 PxDefaultAllocator		gAllocator;
@@ -31,34 +52,208 @@ PxScene*				gScene=nullptr;
 PxMaterial*				gMaterial=nullptr;
 PxPvd*					gPvd=nullptr;
 
-const PxI32 maxCount = 10000;
+// Ŀ 庰  . ũ   þ 峢  ʴ´.
+ContactBuffer gContactBuffer;
+
+// ڳ, ڿ ٴ ̴  / ū  ɸ  ƮѴ.
+enum ReportClass
+{
+	REPORT_CLASS_STATIC = 0,
+	REPORT_CLASS_BOX,
+};
+
+ContactReportPolicy gContactReportPolicy;
+bool gUseContactReportPolicy = true;
+const PxReal gContactForceThreshold = 15000.0f;
+
+// Ӹ Ʈ   Ʈ ũ.  ݹ鿡 .
+std::atomic<PxU32> gReportPairs(0);
+std::atomic<PxU32> gReportBytes(0);
+PxReal gCallbackMilliseconds = 0.0f;
+
+ContactRecorder gContactRecorder;
+
+//  ָ ģ ݷ.      ̰ .
+ContactAggregator gContactAggregator;
+PxU32 gHeavyImpacts = 0;
+
+// ݹ 庰  .
+struct alignas(64) ExtractScratch
+{
+	ContactSoA					contacts;
+
+	// ġũ extractContacts    .
+	std::vector<PxVec3>			positions;
+	std::vector<PxVec3>			normals;
+	std::vector<PxVec3>			impulses;
+	std::vector<PxReal>			separations;
+};
+
+ExtractScratch gExtractScratch[ContactBuffer::MAX_THREADS];
+
+std::atomic<PxU64> gExtractTicks[2];
+std::atomic<PxU64> gExtractContacts(0);
+std::atomic<PxU32> gClippedPairs(0);
+
+//      ð . 0: extractContacts, 1: ContactExtractor
+void BenchmarkExtraction(ExtractScratch& scratch, const PxContactPair* pairs, PxU32 nbPairs)
+{
+	PxContactPairPoint contactPoints[64];
+
+	PxU64 start = SnippetUtils::getCurrentTimeCounterValue();
+
+	scratch.positions.clear();
+	scratch.normals.clear();
+	scratch.impulses.clear();
+	scratch.separations.clear();
+
+	for (PxU32 i = 0; i < nbPairs; i++)
+	{
+		const PxU32 contactCount = pairs[i].extractContacts(&contactPoints[0], 64);
+
+		for (PxU32 j = 0; j < contactCount; j++)
+		{
+			scratch.positions.push_back(contactPoints[j].position);
+			scratch.normals.push_back(contactPoints[j].normal);
+			scratch.impulses.push_back(contactPoints[j].impulse);
+			scratch.separations.push_back(contactPoints[j].separation);
+		}
+	}
+
+	gExtractTicks[0] += SnippetUtils::getCurrentTimeCounterValue() - start;
+	start = SnippetUtils::getCurrentTimeCounterValue();
+
+	scratch.contacts.Clear();
+
+	for (PxU32 i = 0; i < nbPairs; i++)
+	{
+		scratch.contacts.Append(pairs[i]);
+	}
+
+	gExtractTicks[1] += SnippetUtils::getCurrentTimeCounterValue() - start;
+
+	PxU32 nbClipped = 0;
+	for (PxU32 i = 0; i < nbPairs; i++)
+	{
+		nbClipped += pairs[i].contactCount > 64 ? 1 : 0;
+	}
+
+	gExtractContacts += scratch.contacts.GetSize();
+	gClippedPairs += nbClipped;
+}
+
+SceneTuningRecorder gSceneTuningRecorder;
+bool gSceneTuningRecording = false;
+// ġũ  н    н  ʵ .
+bool gUseSceneTuning = true;
+
+
+// ݹ ڿ ̾ ۾.   ݹ ٸ ʰ    .
+TaskChain gTaskChain;
+
+// ݹ   Ѵ. (    ó ڸ)
+struct ContactSummary
+{
+	PxU32	nbContacts;
+	PxReal	maxImpulse;
+};
+
+ContactSummary gContactSummary = {};
+
+class ContactSummaryTask :public PxLightCpuTask
+{
+public:
+	virtual void run() override
+	{
+		ContactSummary summary = {};
+		const PxU32 nbSpans = gContactBuffer.GetNbSpans();
+
+		for (PxU32 i = 0; i < nbSpans; i++)
+		{
+			const ContactBuffer::Span span = gContactBuffer.GetSpan(i);
+			summary.nbContacts += span.count;
 
-std::atomic_int32_t gSharedIndex = 0;
+			for (PxU32 j = 0; j < span.count; j++)
+			{
+				summary.maxImpulse = PxMax(summary.maxImpulse, span.impulses[j].magnitudeSquared());
+			}
+		}
+
+		summary.maxImpulse = PxSqrt(summary.maxImpulse);
+		gContactSummary = summary;
+	}
 
-std::vector<PxVec3> gContactPositions;
-std::vector<PxVec3> gContactImpulses;
-std::vector<PxVec3> gContactVertices;
+	virtual const char* getName() const override { return "ContactSummaryTask"; }
 
+} gContactSummaryTask;
 
-class CallbackFinishTask :public PxLightCpuTask
+class ContactAggregateTask :public PxLightCpuTask
 {
-	SnippetUtils::Sync* m_Sync;
+public:
+	virtual void run() override { gContactAggregator.Merge(); }
+	virtual const char* getName() const override { return "ContactAggregateTask"; }
+
+} gContactAggregateTask;
 
+// fetchResultsFinish     .  尡  ӿ Ƿ    .
+std::vector<PxTransform> gSnapshots[2];
+PxU32 gSnapshotFrame = 0;
+std::vector<PxI8> gSnapshotPacket;
+
+class SnapshotTask :public PxLightCpuTask
+{
 public:
-	CallbackFinishTask() { m_Sync = SnippetUtils::syncCreate(); }
+	virtual void run() override
+	{
+		std::vector<PxTransform>& snapshot = gSnapshots[gSnapshotFrame & 1];
+		snapshot.clear();
+
+		PxActor* actors[256];
+		const PxActorTypeFlags types = PxActorTypeFlag::eRIGID_DYNAMIC;
+		const PxU32 nbActors = gScene->getNbActors(types);
+
+		for (PxU32 i = 0; i < nbActors; i += 256)
+		{
+			const PxU32 nbRead = gScene->getActors(types, actors, 256, i);
+
+			for (PxU32 j = 0; j < nbRead; j++)
+			{
+				snapshot.push_back(static_cast<PxRigidDynamic*>(actors[j])->getGlobalPose());
+			}
+		}
+	}
 
-	virtual void release() override
+	virtual const char* getName() const override { return "SnapshotTask"; }
+
+} gSnapshotTask;
+
+// ݹ    尡    ȭѴ. (δ ⼭ Ŷ .)
+void SendSnapshot(void*)
+{
+	if (gSnapshotFrame == 0)
 	{
-		PxLightCpuTask::release();
-		SnippetUtils::syncSet(m_Sync);
+		return;
 	}
 
-	void Reset() { SnippetUtils::syncReset(m_Sync); }
-	void Wait() { SnippetUtils::syncWait(m_Sync); }
-	virtual void run() override {}
-	virtual const char* getName()const { return "CallbackFinishTask"; }
+	const std::vector<PxTransform>& snapshot = gSnapshots[(gSnapshotFrame - 1) & 1];
+	gSnapshotPacket.clear();
 
-} gCallbackFinishTask;
+	// ġ 1/64  16Ʈ, ȸ и 8Ʈ.
+	for (const PxTransform& pose : snapshot)
+	{
+		for (PxU32 i = 0; i < 3; i++)
+		{
+			const PxI16 position = PxI16(PxClamp(pose.p[i] * 64.0f, -32767.0f, 32767.0f));
+			gSnapshotPacket.push_back(PxI8(position & 0xff));
+			gSnapshotPacket.push_back(PxI8(position >> 8));
+		}
+
+		gSnapshotPacket.push_back(PxI8(pose.q.x * 127.0f));
+		gSnapshotPacket.push_back(PxI8(pose.q.y * 127.0f));
+		gSnapshotPacket.push_back(PxI8(pose.q.z * 127.0f));
+		gSnapshotPacket.push_back(PxI8(pose.q.w * 127.0f));
+	}
+}
 
 //浹 ó Ǵ  ̴ ۼ.  PxDefaultSimulationFilterShader  ȴ.
 PxFilterFlags ContactReportFilterShader(PxFilterObjectAttributes, PxFilterData,
@@ -87,25 +282,55 @@ class ContactReportCallback :public PxSimulationEventCallback
 	virtual void onAdvance(const PxRigidBody* const*, const PxTransform*, const PxU32) override {}
 	virtual void onContact(const PxContactPairHeader& pairHeader, const PxContactPair* pairs, PxU32 nbPairs) override
 	{
-		//  ִ 64 .
-		PxContactPairPoint contactPoints[64];
+		ContactBuffer::Writer& writer = gContactBuffer.GetWriter();
+		ExtractScratch& scratch = gExtractScratch[ContactBuffer::GetThreadIndex() % ContactBuffer::MAX_THREADS];
+
+		PxU32 bytes = sizeof(PxContactPairHeader) + nbPairs * sizeof(PxContactPair);
+		for (PxU32 i = 0; i < nbPairs; i++)
+		{
+			bytes += pairs[i].requiredBufferSize;
+		}
+
+		gReportPairs.fetch_add(nbPairs, std::memory_order_relaxed);
+		gReportBytes.fetch_add(bytes, std::memory_order_relaxed);
+
+		if (gSceneTuningRecording)
+		{
+			gSceneTuningRecorder.RecordContactReport(pairs, nbPairs);
+		}
+
+#if RECORD_CONTACT_LOG
+		gContactRecorder.Record(pairHeader, pairs, nbPairs);
+#endif
+
+#if CONTACT_EXTRACT_BENCHMARK
+		BenchmarkExtraction(scratch, pairs, nbPairs);
+#endif
+
+		// Ʈ SoA  ٷ Ǯ      .
+		ContactSoA& contacts = scratch.contacts;
+		contacts.Clear();
 
 		for (PxU32 i = 0; i < nbPairs; i++)
 		{
-			PxU32 contactCount = pairs[i].contactCount;
-			if (contactCount)
+			if (gUseContactReportPolicy && !gContactReportPolicy.ShouldProcess(pairs[i]))
 			{
-				pairs[i].extractContacts(&contactPoints[0], contactCount);
-
-				PxI32 startIdx = gSharedIndex.fetch_add(contactCount);
-				for (PxU32 j = 0; j < contactCount; j++)
-				{
-					gContactPositions[startIdx + j] = contactPoints[j].position;
-					gContactImpulses[startIdx + j] = contactPoints[j].impulse;
-					gContactVertices[2 * (startIdx + j)] = contactPoints[j].position;
-					gContactVertices[2 * (startIdx + j) + 1] = contactPoints[j].position + contactPoints[j].impulse * 0.1f;
-				}
+				continue;
 			}
+
+			const PxU32 offset = contacts.GetSize();
+			const PxU32 count = contacts.Append(pairs[i]);
+
+			gContactAggregator.Add(pairHeader.actors[0], pairHeader.actors[1], contacts.GetPositions() + offset,
+				contacts.GetNormals() + offset, contacts.GetImpulses() + offset, count);
+		}
+
+		const PxVec3* positions = contacts.GetPositions();
+		const PxVec3* impulses = contacts.GetImpulses();
+
+		for (PxU32 i = 0; i < contacts.GetSize(); i++)
+		{
+			writer.Push(positions[i], impulses[i]);
 		}
 	}
 } gContactReportCallback;
@@ -114,6 +339,7 @@ void CreateStack(const PxTransform& t, PxU32 size, PxReal harfExtent)
 {
 	PxShape* shape = gPhysics->createShape(
 		PxBoxGeometry(harfExtent, harfExtent, harfExtent), *gMaterial);
+	ContactReportPolicy::SetShapeClass(*shape, REPORT_CLASS_BOX);
 
 	for (PxU32 i = 0; i < size; i++)
 	{
@@ -123,6 +349,7 @@ void CreateStack(const PxTransform& t, PxU32 size, PxReal harfExtent)
 			PxRigidDynamic* body = gPhysics->createRigidDynamic(t.transform(localTm));
 			body->attachShape(*shape);
 			PxRigidBodyExt::updateMassAndInertia(*body, 10.0f);
+			ContactReportPolicy::SetForceThreshold(*body, gContactForceThreshold);
 			gScene->addActor(*body);
 		}
 	}
@@ -131,10 +358,6 @@ void CreateStack(const PxTransform& t, PxU32 size, PxReal harfExtent)
 
 void InitPhysics(bool)
 {
-	gContactPositions.resize(maxCount);
-	gContactImpulses.resize(maxCount);
-	gContactVertices.resize(maxCount * 2);
-
 	gFoundation = PxCreateFoundation(PX_PHYSICS_VERSION, gAllocator, gErrorCallback);
 
 	gPvd = PxCreatePvd(*gFoundation);
@@ -152,10 +375,43 @@ void InitPhysics(bool)
 	PxSceneDesc sceneDesc(gPhysics->getTolerancesScale());
 	sceneDesc.cpuDispatcher = gDispatcher;
 	sceneDesc.gravity = PxVec3(0, -9.8f, 0);
-	sceneDesc.filterShader = ContactReportFilterShader;
+	if (gUseContactReportPolicy)
+	{
+		gContactReportPolicy.SetClassFlags(REPORT_CLASS_STATIC, CONTACT_REPORT_NONE);
+		gContactReportPolicy.SetClassFlags(REPORT_CLASS_BOX,
+			CONTACT_REPORT_TOUCH | CONTACT_REPORT_FORCE_THRESHOLD | CONTACT_REPORT_CONTACT_POINTS);
+		gContactReportPolicy.SetPersistInterval(4);
+		gContactReportPolicy.ApplyTo(sceneDesc);
+	}
+	else
+	{
+		sceneDesc.filterShader = ContactReportFilterShader;
+	}
 	sceneDesc.simulationEventCallback = &gContactReportCallback;
+
+	if (gUseSceneTuning)
+	{
+		SceneTuningProfile tuningProfile;
+		if (tuningProfile.Load(SCENE_TUNING_PROFILE))
+		{
+			tuningProfile.ApplyTo(sceneDesc);
+		}
+		else
+		{
+			gSceneTuningRecorder.Reset();
+			gSceneTuningRecording = true;
+		}
+	}
+
 	gScene = gPhysics->createScene(sceneDesc);
 
+	gTaskChain.Clear();
+	gTaskChain.AddAfterCallbacks(gContactSummaryTask);
+	gTaskChain.AddAfterCallbacks(gContactAggregateTask);
+	gTaskChain.AddAfterFetch(gSnapshotTask);
+	gTaskChain.AddMainThreadJob(SendSnapshot, nullptr);
+	gSnapshotFrame = 0;
+
 	PxPvdSceneClient* pvdClient = gScene->getScenePvdClient();
 	if (pvdClient)
 	{
@@ -172,15 +428,24 @@ void InitPhysics(bool)
 	{
 		CreateStack(PxTransform(PxVec3(0, 3.0f, 10.f - 5.f * i)), 5, 2.0f);
 	}
+
+#if RECORD_CONTACT_LOG
+	gContactRecorder.Open(CONTACT_LOG_PATH);
+#endif
 }
 
 void StepPhysics(bool)
 {
-	gSharedIndex = 0;
+	gContactBuffer.Reset();
+	gContactAggregator.Clear();
+	gContactReportPolicy.NewFrame();
+	gReportPairs = 0;
+	gReportBytes = 0;
 
 	gScene->simulate(1.0f / 60.0f);
 
 #if !PARALLEL_CALLBACKS
+	const PxU64 callbackStart = SnippetUtils::getCurrentTimeCounterValue();
 	gScene->fetchResults(true);
 #else
 	// fetchResultStart ȣϿ   ޾ƿ´.
@@ -192,25 +457,71 @@ void StepPhysics(bool)
 		true // true   ޾ƿö Ѵ.
 	);
 
-	// ݹ ķ ó   continuation task ǵ 
-	gCallbackFinishTask.setContinuation(*gScene->getTaskManager(), nullptr);
-	gCallbackFinishTask.Reset();
+	const PxU64 callbackStart = SnippetUtils::getCurrentTimeCounterValue();
 
-	//ݹ ۾
-	gScene->processCallbacks(&gCallbackFinishTask);
+	// ݹ ۾. ݹ     ϵ ۾ óϰ,
+	//  fetchResultsFinish  ̾ ½ũ Ŀ ۵ȴ.
+	gTaskChain.ProcessCallbacks(*gScene);
+	gTaskChain.FetchResultsFinish(*gScene);
+#endif
 
-	gCallbackFinishTask.removeReference();
-	gCallbackFinishTask.Wait();
-	
-	gScene->fetchResultsFinish();
+	gCallbackMilliseconds = SnippetUtils::getElapsedTimeInMilliseconds(SnippetUtils::getCurrentTimeCounterValue() - callbackStart);
+
+#if RECORD_CONTACT_LOG
+	// ̹   ׶ 忡 ѱ.
+	gContactRecorder.EndFrame();
+#endif
+
+	if (gSceneTuningRecording)
+	{
+		gSceneTuningRecorder.RecordFrame(*gScene);
+	}
+
+#if !PARALLEL_CALLBACKS
+	gContactAggregator.Merge();
+#endif
+
+#if PARALLEL_CALLBACKS
+	//   ۾ ̾ ½ũ ļ Ҵ.  ٽ ǵ帮  ٸ.
+	gTaskChain.Wait();
+	gSnapshotFrame++;
 #endif
 
-	printf("%d contact reports\n", PxU32(gSharedIndex));
+	// Ӱ  Ѵ 浹 ط ģ. ָ   .
+	const PxReal damageImpulse = gContactForceThreshold / 60.0f;
+	gHeavyImpacts = 0;
+
+	for (PxU32 i = 0; i < gContactAggregator.GetNbEntries(); i++)
+	{
+		gHeavyImpacts += gContactAggregator.GetEntry(i).totalImpulse > damageImpulse ? 1 : 0;
+	}
+
+#if !CONTACT_REPORT_BENCHMARK && !CONTACT_EXTRACT_BENCHMARK
+#if PARALLEL_CALLBACKS
+	printf("%u contact reports, %u pairs, %u heavy impacts, max impulse %.1f, snapshot %u bytes, main thread idle %.3f ms\n", gContactSummary.nbContacts,
+		gContactAggregator.GetNbEntries(), gHeavyImpacts, gContactSummary.maxImpulse, PxU32(gSnapshotPacket.size()), gTaskChain.GetLastIdleMilliseconds());
+#else
+	printf("%u contact reports\n", gContactBuffer.GetNbContacts());
+#endif
+#endif
 }
 
 
 void CleanupPhysics(bool /*interactive*/)
 {
+	//  ִ 뷮  ࿡   ֵ .
+	if (gSceneTuningRecording && gSceneTuningRecorder.GetNbRecordedFrames())
+	{
+		gSceneTuningRecorder.BuildProfile().Save(SCENE_TUNING_PROFILE);
+		gSceneTuningRecording = false;
+	}
+
+#if RECORD_CONTACT_LOG
+	gContactRecorder.Close();
+#endif
+
+	gTaskChain.Wait();
+
 	PX_RELEASE(gScene);
 	PX_RELEASE(gDispatcher);
 	PxCloseExtensions();
@@ -226,9 +537,114 @@ void CleanupPhysics(bool /*interactive*/)
 	printf("SnippetSplitFetchResults done.\n");
 }
 
+void PrintContactLogSummary()
+{
+	ContactLogReader reader;
+	if (!reader.Open(CONTACT_LOG_PATH))
+	{
+		printf("can't open %s\n", CONTACT_LOG_PATH);
+		return;
+	}
+
+	PxU64 totalPairs = 0;
+	PxU64 totalPoints = 0;
+	PxReal maxImpulse = 0.0f;
+	PxU32 maxImpulseFrame = 0;
+
+	// ʿ (impulses) ȴ´.
+	const PxU32 nbFrames = reader.GetNbFrames();
+	for (PxU32 i = 0; i < nbFrames; i++)
+	{
+		const ContactLogReader::Frame frame = reader.GetFrame(i);
+		totalPairs += frame.nbPairs;
+		totalPoints += frame.nbPoints;
+
+		for (PxU32 j = 0; j < frame.nbPoints; j++)
+		{
+			const PxReal impulse = frame.impulses[j].magnitude();
+			if (impulse > maxImpulse)
+			{
+				maxImpulse = impulse;
+				maxImpulseFrame = frame.frameIndex;
+			}
+		}
+	}
+
+	printf("%s : %u frames, %llu pairs, %llu points, max impulse %.1f at frame %u\n", CONTACT_LOG_PATH, nbFrames,
+		static_cast<unsigned long long>(totalPairs), static_cast<unsigned long long>(totalPoints), maxImpulse, maxImpulseFrame);
+}
+
+void RunContactReportBenchmark()
+{
+	const PxU32 frameCount = 250;
+	const char* names[2] = { "report all", "policy" };
+
+	//  н   ⺻   .
+	gUseSceneTuning = false;
+
+	for (PxU32 pass = 0; pass < 2; pass++)
+	{
+		gUseContactReportPolicy = pass == 1;
+
+		PxU64 totalBytes = 0;
+		PxU64 totalPairs = 0;
+		PxU64 totalContacts = 0;
+		PxReal totalCallbackMs = 0.0f;
+
+		InitPhysics(false);
+		for (PxU32 i = 0; i < frameCount; i++)
+		{
+			StepPhysics(false);
+
+			totalBytes += gReportBytes;
+			totalPairs += gReportPairs;
+			totalContacts += gContactBuffer.GetNbContacts();
+			totalCallbackMs += gCallbackMilliseconds;
+		}
+		CleanupPhysics(false);
+
+		printf("%-10s : %8.1f KB/frame, %7.1f pairs/frame, %8.1f contacts/frame, callbacks %.3f ms/frame\n", names[pass],
+			PxReal(totalBytes) / 1024.0f / frameCount, PxReal(totalPairs) / frameCount,
+			PxReal(totalContacts) / frameCount, totalCallbackMs / frameCount);
+	}
+}
+
+void RunContactExtractBenchmark()
+{
+	const PxU32 frameCount = 250;
+
+	gExtractTicks[0] = 0;
+	gExtractTicks[1] = 0;
+	gExtractContacts = 0;
+	gClippedPairs = 0;
+
+	//     ƮѴ.
+	gUseContactReportPolicy = false;
+	gUseSceneTuning = false;
+
+	InitPhysics(false);
+	for (PxU32 i = 0; i < frameCount; i++)
+	{
+		StepPhysics(false);
+	}
+	CleanupPhysics(false);
+
+	const PxReal nbContacts = PxReal(PxMax<PxU64>(gExtractContacts, 1));
+	const PxReal aosMs = SnippetUtils::getElapsedTimeInMilliseconds(gExtractTicks[0]);
+	const PxReal soaMs = SnippetUtils::getElapsedTimeInMilliseconds(gExtractTicks[1]);
+
+	printf("%llu contacts, %u pairs over 64 points\n", static_cast<unsigned long long>(gExtractContacts), PxU32(gClippedPairs));
+	printf("extractContacts + scatter : %8.3f ms, %6.2f ns/contact\n", aosMs, aosMs * 1.0e6f / nbContacts);
+	printf("ContactExtractor          : %8.3f ms, %6.2f ns/contact\n", soaMs, soaMs * 1.0e6f / nbContacts);
+}
+
 int SnippetMain(int, const char* const*)
 {
-#ifdef RENDER_SNIPPET
+#if CONTACT_REPORT_BENCHMARK
+	RunContactReportBenchmark();
+#elif CONTACT_EXTRACT_BENCHMARK
+	RunContactExtractBenchmark();
+#elif defined(RENDER_SNIPPET)
 	extern void RenderLoop();
 	RenderLoop();
 #else
@@ -236,6 +652,9 @@ int SnippetMain(int, const char* const*)
 	for (PxU32 i = 0; i < 250; i++)
 		StepPhysics(false);
 	CleanupPhysics(false);
+#if RECORD_CONTACT_LOG
+	PrintContactLogSummary();
+#endif
 #endif
 
 	return 0;
@@ -1,27 +1,27 @@
 #ifdef RENDER_SNIPPET
 
 #include <vector>
-#include <atomic>
 
 #include "PxPhysicsAPI.h"
 #include "SnippetRender.h"
 #include "SnippetCamera.h"
 
+#include "ContactBuffer.h"
+
 using namespace physx;
 
 extern void InitPhysics(bool interactive);
 extern void StepPhysics(bool interactive);
 extern void CleanupPhysics(bool interactive);
 
-extern std::vector<PxVec3> gContactPositions;
-extern std::vector<PxVec3> gContactImpulses;
-extern std::vector<PxVec3> gContactVertices;
-extern std::atomic_int32_t gSharedIndex;
+extern ContactBuffer gContactBuffer;
 
 namespace
 {
 	Snippets::Camera* sCamera;
 
+	std::vector<PxVec3> sContactVertices;
+
 	void motionCallback(int x, int y)
 	{
 		sCamera->handleMotion(x, y);
@@ -61,13 +61,27 @@ namespace
 			Snippets::renderActors(&actors[0], static_cast<PxU32>(actors.size()), true);
 		}
 
-		PxI32 count = gSharedIndex;
-		if (count)
+		//  ġ ݷ   ׸.
+		sContactVertices.clear();
+
+		const PxU32 nbSpans = gContactBuffer.GetNbSpans();
+		for (PxU32 i = 0; i < nbSpans; i++)
+		{
+			const ContactBuffer::Span span = gContactBuffer.GetSpan(i);
+
+			for (PxU32 j = 0; j < span.count; j++)
+			{
+				sContactVertices.push_back(span.positions[j]);
+				sContactVertices.push_back(span.positions[j] + span.impulses[j] * 0.1f);
+			}
+		}
+
+		if (sContactVertices.size())
 		{
 			glColor4f(1.0f, 0.0f, 0.0f, 1.0f);
 			glEnableClientState(GL_VERTEX_ARRAY);
-			glVertexPointer(3, GL_FLOAT, 0, &gContactVertices[0]);
-			glDrawArrays(GL_LINES, 0, GLint(count * 2));
+			glVertexPointer(3, GL_FLOAT, 0, &sContactVertices[0]);
+			glDrawArrays(GL_LINES, 0, GLint(sContactVertices.size()));
 			glDisableClientState(GL_VERTEX_ARRAY);
 		}
 
@@ -0,0 +1,296 @@
+#pragma once
+
+#include <new>
+
+#include <PxPhysicsAPI.h>
+
+/*
+	PulleyJoint ó PxConstraintConnector    ʰ,  ϰ  Prep Լ Ʈ  Ʋ.
+
+	Ʈ ϳ Traits ü ϳ Ѵ.
+		struct MyTraits : CustomConstraintTraits
+		{
+			static const physx::PxU32 TYPE_ID = ...;
+			static const char* GetTypeName() { return "MyConstraint"; }	// ȭ ̸. Ʈ ޶ Ѵ.
+			struct Data { ... };		// POD. ״  Ͽ ȴ.
+
+			static physx::PxU32 Prep(physx::Px1DConstraint* rows, physx::PxU32 maxRows, const Data& data, const CustomConstraintFrames& frames);
+
+			// ʿ  ٽ Ѵ. (  CustomConstraintTraits   .)
+			static void ShiftOrigin(Data& data, const physx::PxVec3& shift);
+			static void Visualize(physx::PxConstraintVisualizer& viz, const Data& data, const CustomConstraintFrames& frames);
+		};
+
+	CustomConstraint<MyTraits>  Ŀ, ̴ ̺,  ߽ ̵,  ̵,    markDirty  Ѵ.
+	ֹ Ҹ Լ ø ڷ Ƿ  ȣ .
+	PxBase ̱⵵ ϹǷ PxSerializer  ϸ ̳ʸ ÷ǿ   ִ. (RegisterCustomJointSerializers )
+
+	
+		auto* joint = CustomConstraint<PulleyTraits>::Create(physics, body0, localFrame0, body1, localFrame1, data);
+		joint->Modify().distance = 5.0f;	// markDirty  Ѵ.
+		joint->Release();
+*/
+
+// Prep  Visualize  ѱ  .
+struct CustomConstraintFrames
+{
+	physx::PxTransform	body[2];	// ٵ( ߽) 
+	physx::PxTransform	joint[2];	// Ʈ . x  Ʈ  .
+};
+
+struct CustomConstraintTraits
+{
+	template <class Data>
+	static void ShiftOrigin(Data&, const physx::PxVec3&)
+	{
+	}
+
+	template <class Data>
+	static void Visualize(physx::PxConstraintVisualizer& viz, const Data&, const CustomConstraintFrames& frames)
+	{
+		viz.visualizeJointFrames(frames.joint[0], frames.joint[1]);
+	}
+};
+
+template <class Traits>
+class CustomConstraint : public physx::PxBase, public physx::PxConstraintConnector
+{
+public:
+	typedef typename Traits::Data Data;
+
+	// ٵ ϳ nullptr()  ִ.
+	static CustomConstraint* Create(physx::PxPhysics& physics,
+		physx::PxRigidBody* body0, const physx::PxTransform& localFrame0,
+		physx::PxRigidBody* body1, const physx::PxTransform& localFrame1,
+		const Data& data)
+	{
+		return new CustomConstraint(physics, body0, localFrame0, body1, localFrame1, data);
+	}
+
+	void Release() { m_Constraint->release(); }
+
+	const Data&	GetData() const { return m_Block.data; }
+	Data&		Modify() { m_Constraint->markDirty(); return m_Block.data; }
+
+	physx::PxConstraint*	GetConstraint() const { return m_Constraint; }
+	physx::PxRigidBody*		GetBody(physx::PxU32 index) const { return m_Body[index]; }
+	const physx::PxTransform&	GetLocalFrame(physx::PxU32 index) const { return m_LocalOffset[index]; }
+
+public: // PxBase, ȭ
+	virtual void		release() override { Release(); }
+	virtual const char*	getConcreteTypeName() const override { return Traits::GetTypeName(); }
+
+	void requiresObjects(physx::PxProcessPxBaseCallback& c)
+	{
+		c.process(*m_Constraint);
+
+		for (physx::PxU32 i = 0; i < 2; i++)
+		{
+			if (m_Body[i])
+			{
+				c.process(*m_Body[i]);
+			}
+		}
+	}
+
+	void exportExtraData(physx::PxSerializationContext&) {}
+	void importExtraData(physx::PxDeserializationContext&) {}
+	void preExportDataReset() {}
+
+	void resolveReferences(physx::PxDeserializationContext& context)
+	{
+		context.translatePxBase(m_Constraint);
+		context.translatePxBase(m_Body[0]);
+		context.translatePxBase(m_Body[1]);
+
+		m_Constraint->setConstraintFunctions(*this, m_ShaderTable);
+	}
+
+	static CustomConstraint* createObject(physx::PxU8*& address, physx::PxDeserializationContext& context)
+	{
+		CustomConstraint* constraint = new (address) CustomConstraint(physx::PxBaseFlag::eIS_RELEASABLE);
+		address += sizeof(CustomConstraint);
+		constraint->importExtraData(context);
+		constraint->resolveReferences(context);
+		return constraint;
+	}
+
+	// Ŭ ̸ Traits  ޶ ϹǷ PX_DEF_BIN_METADATA_*  ׸  ´.
+	// Data  POD ̹Ƿ Ʈ 迭 ´.
+	static void getBinaryMetaData(physx::PxOutputStream& stream)
+	{
+		using namespace physx;
+
+		const char* name = Traits::GetTypeName();
+		CustomConstraint* object = reinterpret_cast<CustomConstraint*>(42);
+		const PxU32 baseOffset = PxU32(size_t(static_cast<PxBase*>(object)) - size_t(object));
+		const PxU32 connectorOffset = PxU32(size_t(static_cast<PxConstraintConnector*>(object)) - size_t(object));
+
+		const PxMetaDataEntry entries[] =
+		{
+			{ name, 0, 0, sizeof(CustomConstraint), 0, 0, PxMetaDataFlag::eCLASS | PxMetaDataFlag::eVIRTUAL, 0 },
+			{ name, "PxBase", baseOffset, sizeof(CustomConstraint), 0, 0, PxMetaDataFlag::eCLASS, 0 },
+			{ name, "PxConstraintConnector", connectorOffset, sizeof(CustomConstraint), 0, 0, PxMetaDataFlag::eCLASS, 0 },
+			{ "PxTransform", "m_Block.localFrame", PxU32(PX_OFFSET_OF_RT(CustomConstraint, m_Block.localFrame)), PxU32(sizeof(PxTransform) * 2), 2, 0, 0, 0 },
+			{ "PxU8", "m_Block.data", PxU32(PX_OFFSET_OF_RT(CustomConstraint, m_Block.data)), PxU32(sizeof(Data)), PxU32(sizeof(Data)), 0, 0, 0 },
+			{ "PxRigidBody", "m_Body", PxU32(PX_OFFSET_OF_RT(CustomConstraint, m_Body)), PxU32(sizeof(PxRigidBody*) * 2), 2, 0, PxMetaDataFlag::ePTR, 0 },
+			{ "PxTransform", "m_LocalOffset", PxU32(PX_OFFSET_OF_RT(CustomConstraint, m_LocalOffset)), PxU32(sizeof(PxTransform) * 2), 2, 0, 0, 0 },
+			{ "PxConstraint", "m_Constraint", PxU32(PX_OFFSET_OF_RT(CustomConstraint, m_Constraint)), PxU32(sizeof(PxConstraint*)), 1, 0, PxMetaDataFlag::ePTR, 0 },
+		};
+
+		stream.write(entries, sizeof(entries));
+	}
+
+protected:
+	virtual bool isKindOf(const char* name) const override { return !::strcmp(Traits::GetTypeName(), name) || PxBase::isKindOf(name); }
+
+private:
+	//  .    ߽ ̴.
+	struct Block
+	{
+		physx::PxTransform	localFrame[2];
+		Data				data;
+	};
+
+	CustomConstraint(physx::PxPhysics& physics,
+		physx::PxRigidBody* body0, const physx::PxTransform& localFrame0,
+		physx::PxRigidBody* body1, const physx::PxTransform& localFrame1,
+		const Data& data)
+		: PxBase(Traits::TYPE_ID, physx::PxBaseFlag::eOWNS_MEMORY | physx::PxBaseFlag::eIS_RELEASABLE)
+	{
+		m_Body[0] = body0;
+		m_Body[1] = body1;
+		m_LocalOffset[0] = localFrame0.getNormalized();
+		m_LocalOffset[1] = localFrame1.getNormalized();
+		m_Block.data = data;
+		UpdateLocalFrame(0);
+		UpdateLocalFrame(1);
+
+		m_Constraint = physics.createConstraint(body0, body1, *this, m_ShaderTable, sizeof(Block));
+	}
+
+	// ȭ.  ̳ʸ ״ ä.
+	CustomConstraint(physx::PxBaseFlags baseFlags) : PxBase(baseFlags) {}
+
+	virtual ~CustomConstraint() {}
+
+	void UpdateLocalFrame(physx::PxU32 actor)
+	{
+		m_Block.localFrame[actor] = m_Body[actor] ? m_Body[actor]->getCMassLocalPose().transformInv(m_LocalOffset[actor]) : m_LocalOffset[actor];
+	}
+
+	static void GetFrames(const Block& block, const physx::PxTransform& body0, const physx::PxTransform& body1, CustomConstraintFrames& frames)
+	{
+		frames.body[0] = body0;
+		frames.body[1] = body1;
+		frames.joint[0] = body0 * block.localFrame[0];
+		frames.joint[1] = body1 * block.localFrame[1];
+	}
+
+private: // PxConstraintConnector
+	virtual void* prepareData() override { return &m_Block; }
+	virtual void onConstraintRelease() override
+	{
+		// ȭ ü ÷ ޸  ȿ Ƿ Ҹڸ θ.
+		if (getBaseFlags() & physx::PxBaseFlag::eOWNS_MEMORY)
+		{
+			delete this;
+		}
+		else
+		{
+			this->~CustomConstraint();
+		}
+	}
+
+	virtual void onComShift(physx::PxU32 actor) override
+	{
+		UpdateLocalFrame(actor);
+		m_Constraint->markDirty();
+	}
+
+	virtual void onOriginShift(const physx::PxVec3& shift) override
+	{
+		Traits::ShiftOrigin(m_Block.data, shift);
+
+		// 忡     ǥ̹Ƿ  ű.
+		for (physx::PxU32 i = 0; i < 2; i++)
+		{
+			if (!m_Body[i])
+			{
+				m_LocalOffset[i].p -= shift;
+				UpdateLocalFrame(i);
+			}
+		}
+
+		m_Constraint->markDirty();
+	}
+
+	virtual void* getExternalReference(physx::PxU32& typeID) override
+	{
+		typeID = Traits::TYPE_ID;
+		return this;
+	}
+
+	virtual bool updatePvdProperties(physx::pvdsdk::PvdDataStream&,
+		const physx::PxConstraint*,
+		physx::PxPvdUpdateType::Enum) const override { return true; }
+
+	virtual physx::PxBase* getSerializable() override { return this; }
+	virtual physx::PxConstraintSolverPrep getPrep() const override { return m_ShaderTable.solverPrep; }
+	virtual const void* getConstantBlock() const override { return &m_Block; }
+
+private: // ̴ ̺
+	static physx::PxU32 SolverPrep(physx::Px1DConstraint* constraints,
+		physx::PxVec3& body0WorldOffset,
+		physx::PxU32 maxConstraints,
+		physx::PxConstraintInvMassScale&,
+		const void* constantBlock,
+		const physx::PxTransform& body0World,
+		const physx::PxTransform& body1World,
+		bool,
+		physx::PxVec3& body0WorldOut, physx::PxVec3& body1WorldOut)
+	{
+		const Block& block = *reinterpret_cast<const Block*>(constantBlock);
+
+		CustomConstraintFrames frames;
+		GetFrames(block, body0World, body1World, frames);
+
+		body0WorldOut = frames.joint[0].p;
+		body1WorldOut = frames.joint[1].p;
+		body0WorldOffset = frames.joint[1].p - body0World.p;
+
+		return Traits::Prep(constraints, maxConstraints, block.data, frames);
+	}
+
+	static void Visualize(physx::PxConstraintVisualizer& viz,
+		const void* constantBlock,
+		const physx::PxTransform& body0Transform,
+		const physx::PxTransform& body1Transform,
+		physx::PxU32)
+	{
+		const Block& block = *reinterpret_cast<const Block*>(constantBlock);
+
+		CustomConstraintFrames frames;
+		GetFrames(block, body0Transform, body1Transform, frames);
+		Traits::Visualize(viz, block.data, frames);
+	}
+
+	static void Project(const void*, physx::PxTransform&, physx::PxTransform&, bool)
+	{
+	}
+
+private:
+	Block					m_Block;
+	physx::PxRigidBody*		m_Body[2];
+	physx::PxTransform		m_LocalOffset[2];
+	physx::PxConstraint*	m_Constraint;
+
+	static physx::PxConstraintShaderTable m_ShaderTable;
+};
+
+template <class Traits>
+physx::PxConstraintShaderTable CustomConstraint<Traits>::m_ShaderTable = {
+	&CustomConstraint<Traits>::SolverPrep,
+	&CustomConstraint<Traits>::Project,
+	&CustomConstraint<Traits>::Visualize,
+	physx::PxConstraintFlag::Enum(0) };
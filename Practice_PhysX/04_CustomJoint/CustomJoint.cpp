@@ -1,12 +1,31 @@
 #include <ctype.h>
+#include <vector>
 
 #include "PxPhysicsAPI.h"
+#include "extensions/PxCollectionExt.h"
 
 #include "SnippetPrint.h"
 #include "SnippetPVD.h"
 #include "SnippetUtils.h"
+#include "SceneRelease.h"
 
 #include "PulleyJoint.h"
+#include "PulleyBatch.h"
+#include "ImmediatePulley.h"
+#include "CustomJoints.h"
+#include "CustomJointSerialization.h"
+
+// 1̸   PulleyJoint  PulleyBatch   1   Ѵ.
+#define PULLEY_BATCH_BENCHMARK 0
+
+// 1̸       ý 1   ʴ   .
+#define PULLEY_IMMEDIATE_BENCHMARK 0
+
+// 1̸   PulleyJoint  CustomConstraint<PulleyTraits>   1   Ѵ.
+#define CUSTOM_CONSTRAINT_BENCHMARK 0
+
+// 1̸    1    ̳ʸ ȭϰ, ٽ о ̴ ð Ʈ   Ѵ.
+#define PULLEY_SERIALIZATION_BENCHMARK 0
 
 using namespace physx;
 
@@ -64,6 +83,42 @@ void InitPhysics(bool)
 
 	gScene->addActor(*box0);
 	gScene->addActor(*box1);
+
+	// .   z   ,   ͷ    ݴ  ӵ .
+	const PxQuat hingeZ(PxHalfPi, PxVec3(0.0f, 1.0f, 0.0f));	// Ʈ  x  ->  z 
+	const PxBoxGeometry plateGeom(2.0f, 2.0f, 0.2f);
+
+	PxRigidDynamic* gear0 = PxCreateDynamic(*gPhysics, PxTransform(PxVec3(-10.0f, 6.0f, 0.0f)), plateGeom, *gMaterial, 1.0f);
+	PxRigidDynamic* gear1 = PxCreateDynamic(*gPhysics, PxTransform(PxVec3(-16.0f, 6.0f, 0.0f)), plateGeom, *gMaterial, 1.0f);
+
+	PxRevoluteJoint* motor = PxRevoluteJointCreate(*gPhysics, NULL, PxTransform(gear0->getGlobalPose().p, hingeZ), gear0, PxTransform(hingeZ));
+	motor->setDriveVelocity(1.0f);
+	motor->setRevoluteJointFlag(PxRevoluteJointFlag::eDRIVE_ENABLED, true);
+	PxRevoluteJointCreate(*gPhysics, NULL, PxTransform(gear1->getGlobalPose().p, hingeZ), gear1, PxTransform(hingeZ));
+
+	GearTraits::Data gearData;
+	gearData.ratio = 0.5f;
+	GearConstraint::Create(*gPhysics, gear0, PxTransform(hingeZ), gear1, PxTransform(hingeZ), gearData);
+
+	// ǴϾ. ǴϾ  Ʒ 밡 x  ̲.
+	PxRigidDynamic* pinion = PxCreateDynamic(*gPhysics, PxTransform(PxVec3(-10.0f, 14.0f, 0.0f)), plateGeom, *gMaterial, 1.0f);
+	PxRigidDynamic* rack = PxCreateDynamic(*gPhysics, PxTransform(PxVec3(-10.0f, 11.5f, 0.0f)), PxBoxGeometry(6.0f, 0.3f, 0.3f), *gMaterial, 1.0f);
+
+	PxRevoluteJoint* pinionMotor = PxRevoluteJointCreate(*gPhysics, NULL, PxTransform(pinion->getGlobalPose().p, hingeZ), pinion, PxTransform(hingeZ));
+	pinionMotor->setDriveVelocity(0.5f);
+	pinionMotor->setRevoluteJointFlag(PxRevoluteJointFlag::eDRIVE_ENABLED, true);
+	PxPrismaticJointCreate(*gPhysics, NULL, rack->getGlobalPose(), rack, PxTransform(PxIdentity));
+
+	RackAndPinionTraits::Data rackData;
+	rackData.radius = 2.0f;
+	RackAndPinionConstraint::Create(*gPhysics, pinion, PxTransform(hingeZ), rack, PxTransform(PxIdentity), rackData);
+
+	PxRigidDynamic* gearBodies[] = { gear0, gear1, pinion, rack };
+	for (PxRigidDynamic* body : gearBodies)
+	{
+		body->setSleepThreshold(0.0f);
+		gScene->addActor(*body);
+	}
 }
 
 void StepPhysics(bool)
@@ -92,9 +147,445 @@ void KeyPress(unsigned char, const PxTransform&)
 {
 }
 
+// ġũ .  ڸ  ٸ տ Ŵް ſ   Ѵ.
+struct PulleySetup
+{
+	PxRigidDynamic*	box[2];
+	PxTransform		localFrame;
+	PxVec3			attachment[2];
+	PxReal			distance;
+};
+
+const PxU32 gBenchmarkGrid = 100;	// 100 x 100 = 10000
+const PxU32 gBenchmarkWarmUpFrames = 30;
+const PxU32 gBenchmarkFrames = 200;
+
+void CreateBenchmarkPulleys(PxScene& scene, std::vector<PulleySetup>& setups)
+{
+	const PxBoxGeometry boxGeom(0.5f, 0.5f, 0.5f);
+	const PxReal spacing = 8.0f;
+	const PxReal origin = -0.5f * spacing * PxReal(gBenchmarkGrid - 1);
+
+	for (PxU32 i = 0; i < gBenchmarkGrid; i++)
+	{
+		for (PxU32 j = 0; j < gBenchmarkGrid; j++)
+		{
+			const PxVec3 base(origin + PxReal(i) * spacing, 0.0f, origin + PxReal(j) * spacing);
+
+			PulleySetup setup;
+			setup.localFrame = PxTransform(PxVec3(0.0f, 0.5f, 0.0f));
+			setup.box[0] = PxCreateDynamic(*gPhysics, PxTransform(base + PxVec3(2.0f, 5.0f, 0.0f)), boxGeom, *gMaterial, 1.0f);
+			setup.box[1] = PxCreateDynamic(*gPhysics, PxTransform(base + PxVec3(-2.0f, 5.0f, 0.0f)), boxGeom, *gMaterial, 2.0f);
+			setup.attachment[0] = base + PxVec3(2.0f, 12.0f, 0.0f);
+			setup.attachment[1] = base + PxVec3(-2.0f, 12.0f, 0.0f);
+
+			// ó ̸ ״ .
+			setup.distance = 0.0f;
+
+			for (PxU32 b = 0; b < 2; b++)
+			{
+				const PxVec3 joint = setup.box[b]->getGlobalPose().transform(setup.localFrame.p);
+				setup.distance += (setup.attachment[b] - joint).magnitude();
+
+				//  ߿  ʵ Ѵ.
+				setup.box[b]->setSleepThreshold(0.0f);
+				scene.addActor(*setup.box[b]);
+			}
+
+			setups.push_back(setup);
+		}
+	}
+}
+
+//      .     ȮѴ.
+PxReal MeasurePulleyError(const std::vector<PulleySetup>& setups)
+{
+	PxReal sum = 0.0f;
+
+	for (const PulleySetup& it : setups)
+	{
+		PxReal length = 0.0f;
+
+		for (PxU32 b = 0; b < 2; b++)
+		{
+			length += (it.attachment[b] - it.box[b]->getGlobalPose().transform(it.localFrame.p)).magnitude();
+		}
+
+		sum += PxAbs(it.distance - length);
+	}
+
+	return sum / PxReal(setups.size());
+}
+
+enum PulleyMode
+{
+	ePULLEY_NONE,		// ڸ
+	ePULLEY_JOINT,		//   PulleyJoint
+	ePULLEY_BATCH,		// PulleyBatch
+	ePULLEY_TEMPLATE,	// CustomConstraint<PulleyTraits>
+};
+
+const char* GetPulleyModeName(PulleyMode mode)
+{
+	switch (mode)
+	{
+	case ePULLEY_NONE:		return "no joints";
+	case ePULLEY_JOINT:		return "PulleyJoint";
+	case ePULLEY_BATCH:		return "PulleyBatch";
+	case ePULLEY_TEMPLATE:	return "PulleyTraits";
+	}
+	return "";
+}
+
+void CreatePulleyJoints(PulleyMode mode, const std::vector<PulleySetup>& setups, PulleyBatch& batch)
+{
+	for (const PulleySetup& it : setups)
+	{
+		if (mode == ePULLEY_JOINT)
+		{
+			PulleyJoint* joint = new PulleyJoint(*gPhysics, *it.box[0], it.localFrame, it.attachment[0],
+				*it.box[1], it.localFrame, it.attachment[1]);
+			joint->SetDistance(it.distance);
+		}
+		else if (mode == ePULLEY_BATCH)
+		{
+			batch.Add(*it.box[0], it.localFrame, it.attachment[0], *it.box[1], it.localFrame, it.attachment[1], it.distance);
+		}
+		else if (mode == ePULLEY_TEMPLATE)
+		{
+			PulleyTraits::Data data;
+			data.attachment0 = it.attachment[0];
+			data.attachment1 = it.attachment[1];
+			data.distance = it.distance;
+			data.ratio = 1.0f;
+			PulleyConstraint::Create(*gPhysics, it.box[0], it.localFrame, it.box[1], it.localFrame, data);
+		}
+	}
+}
+
+void RunPulleyBenchmark(const PulleyMode* modes, PxU32 nbModes)
+{
+	InitPhysics(false);
+
+	printf("%u pulleys, %u frames\n", gBenchmarkGrid * gBenchmarkGrid, gBenchmarkFrames);
+	printf("%-12s %10s %10s %10s %10s\n", "mode", "step ms", "gather ms", "prep ms", "avg error");
+
+	for (PxU32 m = 0; m < nbModes; m++)
+	{
+		const PulleyMode mode = modes[m];
+
+		PxSceneDesc sceneDesc(gPhysics->getTolerancesScale());
+		sceneDesc.gravity = PxVec3(0.0f, -9.81f, 0.0f);
+		sceneDesc.cpuDispatcher = gDispatcher;
+		sceneDesc.filterShader = PxDefaultSimulationFilterShader;
+		PxScene* scene = gPhysics->createScene(sceneDesc);
+		scene->addActor(*PxCreatePlane(*gPhysics, PxPlane(0, 1, 0, 0), *gMaterial));
+
+		std::vector<PulleySetup> setups;
+		CreateBenchmarkPulleys(*scene, setups);
+
+		PulleyBatch batch(*gPhysics);
+		CreatePulleyJoints(mode, setups, batch);
+
+		PxU64 stepTicks = 0;
+		PxReal gatherMs = 0.0f;
+		PxReal prepareMs = 0.0f;
+
+		for (PxU32 i = 0; i < gBenchmarkWarmUpFrames + gBenchmarkFrames; i++)
+		{
+			const PxU64 start = SnippetUtils::getCurrentTimeCounterValue();
+
+			if (mode == ePULLEY_BATCH)
+			{
+				batch.Prepare();
+			}
+
+			scene->simulate(1.0f / 60.0f);
+			scene->fetchResults(true);
+
+			if (i >= gBenchmarkWarmUpFrames)
+			{
+				stepTicks += SnippetUtils::getCurrentTimeCounterValue() - start;
+				gatherMs += batch.GetLastGatherMilliseconds();
+				prepareMs += batch.GetLastPrepareMilliseconds();
+			}
+		}
+
+		const PxReal frames = PxReal(gBenchmarkFrames);
+		printf("%-12s %10.3f %10.3f %10.3f %10.4f\n", GetPulleyModeName(mode),
+			SnippetUtils::getElapsedTimeInMilliseconds(stepTicks) / frames, gatherMs / frames, prepareMs / frames,
+			MeasurePulleyError(setups));
+
+		batch.Release();
+		ReleaseScene(*scene);
+	}
+
+	CleanupPhysics(false);
+}
+
+// о  ÷      .
+PxReal MeasureLoadedPulleyError(PxCollection& collection, PxU32& nbPulleys)
+{
+	PxReal sum = 0.0f;
+	nbPulleys = 0;
+
+	for (PxU32 i = 0; i < collection.getNbObjects(); i++)
+	{
+		PxBase& object = collection.getObject(i);
+		PxReal length = 0.0f;
+		PxReal distance = 0.0f;
+
+		if (object.getConcreteType() == PulleyJoint::TYPE_ID)
+		{
+			const PulleyJoint& joint = static_cast<PulleyJoint&>(object);
+			const PxVec3 attachments[2] = { joint.GetAttachment0(), joint.GetAttachment1() };
+
+			for (PxU32 b = 0; b < 2; b++)
+			{
+				length += (attachments[b] - joint.GetBody(b)->getGlobalPose().transform(joint.GetLocalFrame(b).p)).magnitude();
+			}
+
+			distance = joint.GetDistance();
+		}
+		else if (object.getConcreteType() == PulleyTraits::TYPE_ID)
+		{
+			const PulleyConstraint& joint = static_cast<PulleyConstraint&>(object);
+			const PxVec3 attachments[2] = { joint.GetData().attachment0, joint.GetData().attachment1 };
+
+			for (PxU32 b = 0; b < 2; b++)
+			{
+				length += (attachments[b] - joint.GetBody(b)->getGlobalPose().transform(joint.GetLocalFrame(b).p)).magnitude();
+			}
+
+			distance = joint.GetData().distance;
+		}
+		else
+		{
+			continue;
+		}
+
+		sum += PxAbs(distance - length);
+		nbPulleys++;
+	}
+
+	return nbPulleys ? sum / PxReal(nbPulleys) : 0.0f;
+}
+
+// complete  followJoints  PxConstraintExtIDs::eJOINT  󰡹Ƿ  Ʈ ٵ ࿡  ã ִ´.
+void AddUserJoints(PxCollection& collection, PxRigidActor& actor)
+{
+	PxConstraint* constraints[8];
+	const PxU32 nbConstraints = actor.getConstraints(constraints, 8);
+
+	for (PxU32 i = 0; i < nbConstraints; i++)
+	{
+		PxU32 type;
+		void* external = constraints[i]->getExternalReference(type);
+		PxBase* joint = nullptr;
+
+		if (type == PulleyJoint::TYPE_ID)
+			joint = static_cast<PulleyJoint*>(external);
+		else if (type == PulleyTraits::TYPE_ID)
+			joint = static_cast<PulleyConstraint*>(external);
+
+		// Ʈ ϳ  ٵ ɷ Ƿ    ʴ´.
+		if (joint && !collection.contains(*joint))
+			collection.add(*joint);
+	}
+}
+
+void RunPulleySerializationBenchmark()
+{
+	InitPhysics(false);
+
+	PxSerializationRegistry* registry = PxSerialization::createSerializationRegistry(*gPhysics);
+	RegisterCustomJointSerializers(*registry);
+
+	//   ÷  Ƿ ܺ  .
+	PxCollection* shared = PxCreateCollection();
+	shared->add(*gMaterial);
+	PxSerialization::createSerialObjectIds(*shared, PxSerialObjectId(1));
+
+	printf("%u pulleys\n", gBenchmarkGrid * gBenchmarkGrid);
+	printf("%-12s %10s %10s %10s %10s %10s\n", "mode", "KB", "save ms", "load ms", "joints", "avg error");
+
+	const PulleyMode modes[] = { ePULLEY_NONE, ePULLEY_JOINT, ePULLEY_TEMPLATE };
+
+	for (PulleyMode mode : modes)
+	{
+		PxSceneDesc sceneDesc(gPhysics->getTolerancesScale());
+		sceneDesc.gravity = PxVec3(0.0f, -9.81f, 0.0f);
+		sceneDesc.cpuDispatcher = gDispatcher;
+		sceneDesc.filterShader = PxDefaultSimulationFilterShader;
+
+		// 1.    ̳ʸ Ѵ. Ʈ  ࿡ ã ִ´.
+		PxScene* sourceScene = gPhysics->createScene(sceneDesc);
+
+		std::vector<PulleySetup> setups;
+		CreateBenchmarkPulleys(*sourceScene, setups);
+
+		PulleyBatch batch(*gPhysics);
+		CreatePulleyJoints(mode, setups, batch);
+
+		const PxU64 saveStart = SnippetUtils::getCurrentTimeCounterValue();
+
+		PxCollection* collection = PxCreateCollection();
+		for (const PulleySetup& it : setups)
+		{
+			collection->add(*it.box[0]);
+			collection->add(*it.box[1]);
+			AddUserJoints(*collection, *it.box[0]);
+		}
+
+		PxSerialization::complete(*collection, *registry, shared, true);
+
+		PxDefaultMemoryOutputStream output;
+		const bool saved = PxSerialization::serializeCollectionToBinary(output, *collection, *registry, shared);
+
+		const PxReal saveMs = SnippetUtils::getElapsedTimeInMilliseconds(SnippetUtils::getCurrentTimeCounterValue() - saveStart);
+
+		PxCollectionExt::releaseObjects(*collection);
+		collection->release();
+		ReleaseScene(*sourceScene);
+
+		if (!saved)
+		{
+			printf("%-12s serialization failed\n", GetPulleyModeName(mode));
+			continue;
+		}
+
+		// 2. 128 Ʈ ĵ Ͽ ÷ о δ.  ü    ־ Ѵ.
+		std::vector<PxU8> block(output.getSize() + PX_SERIAL_FILE_ALIGN);
+		void* memory = reinterpret_cast<void*>((size_t(block.data()) + PX_SERIAL_FILE_ALIGN) & ~size_t(PX_SERIAL_FILE_ALIGN - 1));
+		PxMemCopy(memory, output.getData(), output.getSize());
+
+		PxScene* scene = gPhysics->createScene(sceneDesc);
+		scene->addActor(*PxCreatePlane(*gPhysics, PxPlane(0, 1, 0, 0), *gMaterial));
+
+		const PxU64 loadStart = SnippetUtils::getCurrentTimeCounterValue();
+
+		PxCollection* loaded = PxSerialization::createCollectionFromBinary(memory, *registry, shared);
+		scene->addCollection(*loaded);
+
+		const PxReal loadMs = SnippetUtils::getElapsedTimeInMilliseconds(SnippetUtils::getCurrentTimeCounterValue() - loadStart);
+
+		// 3.    о  Ʈ  ϴ .
+		for (PxU32 i = 0; i < gBenchmarkWarmUpFrames; i++)
+		{
+			scene->simulate(1.0f / 60.0f);
+			scene->fetchResults(true);
+		}
+
+		PxU32 nbPulleys = 0;
+		const PxReal error = MeasureLoadedPulleyError(*loaded, nbPulleys);
+
+		const PxU32 expectedPulleys = mode == ePULLEY_NONE ? 0 : PxU32(setups.size());
+		PX_ASSERT(nbPulleys == expectedPulleys);
+		if (nbPulleys != expectedPulleys)
+			printf("%-12s loaded %u of %u joints\n", GetPulleyModeName(mode), nbPulleys, expectedPulleys);
+
+		printf("%-12s %10.1f %10.3f %10.3f %10u %10.4f\n", GetPulleyModeName(mode),
+			PxReal(output.getSize()) / 1024.0f, saveMs, loadMs, nbPulleys, error);
+
+		// ٴ ÷ ̶ ReleaseScene  .
+		PxCollectionExt::releaseObjects(*loaded);
+		loaded->release();
+		ReleaseScene(*scene);
+	}
+
+	shared->release();
+	UnregisterCustomJointSerializers(*registry);
+	registry->release();
+
+	CleanupPhysics(false);
+}
+
+void RunImmediatePulleyBenchmark()
+{
+	const PxU32 nbPulleys = gBenchmarkGrid * gBenchmarkGrid;
+	const PxU32 nbSteps = 300;
+	const PxVec3 halfExtents(0.5f);
+
+	gFoundation = PxCreateFoundation(PX_PHYSICS_VERSION, gAllocator, gErrorCallback);
+
+	const PxU32 numCores = SnippetUtils::getNbPhysicalCores();
+	const PxU32 nbThreads = numCores > 1 ? numCores - 1 : 1;
+	PxDefaultCpuDispatcher* dispatcher = PxDefaultCpuDispatcherCreate(nbThreads);
+
+	printf("%u pulleys, %u steps\n", nbPulleys, nbSteps);
+	printf("%-8s %10s %12s %14s %10s\n", "islands", "ms", "steps/s", "pulley steps/s", "avg error");
+
+	//  ϳ(ǻ  )  ŭ  츦 Ѵ.
+	const PxU32 islandCounts[] = { 1, nbThreads, nbThreads * 4 };
+
+	for (PxU32 islands : islandCounts)
+	{
+		ImmediatePulleyWorld world;
+		world.Init(*dispatcher, islands);
+
+		for (PxU32 i = 0; i < nbPulleys; i++)
+		{
+			const PxVec3 base(PxReal(i % gBenchmarkGrid) * 8.0f, 0.0f, PxReal(i / gBenchmarkGrid) * 8.0f);
+			const PxTransform pose0(base + PxVec3(2.0f, 5.0f, 0.0f));
+			const PxTransform pose1(base + PxVec3(-2.0f, 5.0f, 0.0f));
+			const PxVec3 attachment0 = base + PxVec3(2.0f, 12.0f, 0.0f);
+			const PxVec3 attachment1 = base + PxVec3(-2.0f, 12.0f, 0.0f);
+
+			// ó ̸ ״ . ſ  .
+			const PxReal distance = (attachment0 - (pose0.p + PxVec3(0.0f, 0.5f, 0.0f))).magnitude()
+				+ (attachment1 - (pose1.p + PxVec3(0.0f, 0.5f, 0.0f))).magnitude();
+
+			world.AddPulley(1.0f, halfExtents, pose0, attachment0, 2.0f, halfExtents, pose1, attachment1, distance);
+		}
+
+		const PxU64 start = SnippetUtils::getCurrentTimeCounterValue();
+
+		for (PxU32 i = 0; i < nbSteps; i++)
+		{
+			world.Step(1.0f / 60.0f);
+		}
+
+		const PxReal ms = SnippetUtils::getElapsedTimeInMilliseconds(SnippetUtils::getCurrentTimeCounterValue() - start);
+
+		PxReal error = 0.0f;
+
+		for (PxU32 i = 0; i < nbPulleys; i++)
+		{
+			PxReal length = 0.0f;
+
+			for (PxU32 b = 0; b < 2; b++)
+			{
+				const PxVec3 joint = world.GetBodyPose(i, b).transform(PxVec3(0.0f, halfExtents.y, 0.0f));
+				length += (world.GetAttachment(i, b) - joint).magnitude();
+			}
+
+			error += PxAbs(world.GetDistance(i) - length);
+		}
+
+		const PxReal stepsPerSecond = PxReal(nbSteps) * 1000.0f / ms;
+		printf("%-8u %10.3f %12.1f %14.0f %10.4f\n", islands, ms, stepsPerSecond, stepsPerSecond * PxReal(nbPulleys),
+			error / PxReal(nbPulleys));
+
+		world.Release();
+	}
+
+	PX_RELEASE(dispatcher);
+	PX_RELEASE(gFoundation);
+}
+
 int SnippetMain(int, const char* const*)
 {
-#ifdef RENDER_SNIPPET
+#if PULLEY_BATCH_BENCHMARK
+	const PulleyMode modes[] = { ePULLEY_JOINT, ePULLEY_BATCH };
+	RunPulleyBenchmark(modes, PX_ARRAY_SIZE(modes));
+#elif CUSTOM_CONSTRAINT_BENCHMARK
+	const PulleyMode modes[] = { ePULLEY_JOINT, ePULLEY_TEMPLATE };
+	RunPulleyBenchmark(modes, PX_ARRAY_SIZE(modes));
+#elif PULLEY_SERIALIZATION_BENCHMARK
+	RunPulleySerializationBenchmark();
+#elif PULLEY_IMMEDIATE_BENCHMARK
+	RunImmediatePulleyBenchmark();
+#elif defined(RENDER_SNIPPET)
 	extern void RenderLoop();
 	RenderLoop();
 #else
@@ -0,0 +1,34 @@
+#include "CustomJointSerialization.h"
+
+#include "PulleyJoint.h"
+#include "CustomJoints.h"
+
+using namespace physx;
+
+namespace
+{
+	void GetCustomJointBinaryMetaData(PxOutputStream& stream)
+	{
+		PulleyJoint::getBinaryMetaData(stream);
+		PulleyConstraint::getBinaryMetaData(stream);
+		GearConstraint::getBinaryMetaData(stream);
+		RackAndPinionConstraint::getBinaryMetaData(stream);
+	}
+}
+
+void RegisterCustomJointSerializers(PxSerializationRegistry& registry)
+{
+	registry.registerSerializer(PulleyJoint::TYPE_ID, PX_NEW_SERIALIZER_ADAPTER(PulleyJoint));
+	registry.registerSerializer(PulleyTraits::TYPE_ID, PX_NEW_SERIALIZER_ADAPTER(PulleyConstraint));
+	registry.registerSerializer(GearTraits::TYPE_ID, PX_NEW_SERIALIZER_ADAPTER(GearConstraint));
+	registry.registerSerializer(RackAndPinionTraits::TYPE_ID, PX_NEW_SERIALIZER_ADAPTER(RackAndPinionConstraint));
+	registry.registerBinaryMetaDataCallback(GetCustomJointBinaryMetaData);
+}
+
+void UnregisterCustomJointSerializers(PxSerializationRegistry& registry)
+{
+	PX_DELETE_SERIALIZER_ADAPTER(registry.unregisterSerializer(PulleyJoint::TYPE_ID));
+	PX_DELETE_SERIALIZER_ADAPTER(registry.unregisterSerializer(PulleyTraits::TYPE_ID));
+	PX_DELETE_SERIALIZER_ADAPTER(registry.unregisterSerializer(GearTraits::TYPE_ID));
+	PX_DELETE_SERIALIZER_ADAPTER(registry.unregisterSerializer(RackAndPinionTraits::TYPE_ID));
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <PxPhysicsAPI.h>
+
+/*
+	PulleyJoint  CustomConstraint Ʈ PxSerializer  ̳ʸ Ÿ͸ Ѵ.
+	صθ  Ʈ  ִ ÷ǵ serializeCollectionToBinary / createCollectionFromBinary  ״ .
+
+	PulleyBatch  Ŀʹ ġ ü 迭 ŰǷ ȭ ʴ´.
+
+	
+		PxSerializationRegistry* registry = PxSerialization::createSerializationRegistry(physics);
+		RegisterCustomJointSerializers(*registry);
+		...
+		UnregisterCustomJointSerializers(*registry);
+		registry->release();
+*/
+
+void RegisterCustomJointSerializers(physx::PxSerializationRegistry& registry);
+void UnregisterCustomJointSerializers(physx::PxSerializationRegistry& registry);
@@ -0,0 +1,80 @@
+#include "CustomJoints.h"
+
+using namespace physx;
+
+PxU32 PulleyTraits::Prep(Px1DConstraint* rows, PxU32, const Data& data, const CustomConstraintFrames& frames)
+{
+	const PxVec3 joint0 = frames.joint[0].p;
+	const PxVec3 joint1 = frames.joint[1].p;
+
+	PxVec3 dir0 = data.attachment0 - joint0;
+	const PxReal length0 = dir0.normalize();
+
+	PxVec3 dir1 = data.attachment1 - joint1;
+	const PxReal length1 = dir1.normalize() * data.ratio;
+
+	const PxReal geometricError = data.distance - (length0 + length1);
+
+	//  ⸸ Ѵ. ̰    ʴ´.
+	Px1DConstraint& c = rows[0];
+	c.flags = Px1DConstraintFlag::eOUTPUT_FORCE;
+	c.geometricError = geometricError;
+	c.velocityTarget = 0.0f;
+	c.minImpulse = geometricError < 0.0f ? 0.0f : -PX_MAX_F32;
+	c.maxImpulse = geometricError < 0.0f ? PX_MAX_F32 : 0.0f;
+
+	c.linear0 = dir0;
+	c.angular0 = (joint0 - frames.body[0].p).cross(c.linear0);
+	c.linear1 = -dir1;
+	c.angular1 = (joint1 - frames.body[1].p).cross(c.linear1);
+
+	return 1;
+}
+
+void PulleyTraits::ShiftOrigin(Data& data, const PxVec3& shift)
+{
+	data.attachment0 -= shift;
+	data.attachment1 -= shift;
+}
+
+void PulleyTraits::Visualize(PxConstraintVisualizer& viz, const Data& data, const CustomConstraintFrames& frames)
+{
+	viz.visualizeLine(frames.joint[0].p, data.attachment0, 0xff000000);
+	viz.visualizeLine(frames.joint[1].p, data.attachment1, 0xff000000);
+}
+
+PxU32 GearTraits::Prep(Px1DConstraint* rows, PxU32, const Data& data, const CustomConstraintFrames& frames)
+{
+	// ӵ ´. ϰ ̲  ǵ ʴ´.
+	Px1DConstraint& c = rows[0];
+	c.flags = Px1DConstraintFlag::eOUTPUT_FORCE | Px1DConstraintFlag::eANGULAR_CONSTRAINT;
+	c.geometricError = 0.0f;
+	c.velocityTarget = 0.0f;
+	c.minImpulse = -PX_MAX_F32;
+	c.maxImpulse = PX_MAX_F32;
+
+	c.linear0 = PxVec3(0.0f);
+	c.angular0 = frames.joint[0].q.getBasisVector0() * data.ratio;
+	c.linear1 = PxVec3(0.0f);
+	c.angular1 = -frames.joint[1].q.getBasisVector0();
+
+	return 1;
+}
+
+PxU32 RackAndPinionTraits::Prep(Px1DConstraint* rows, PxU32, const Data& data, const CustomConstraintFrames& frames)
+{
+	// ǴϾ  ӵ =  ӵ
+	Px1DConstraint& c = rows[0];
+	c.flags = Px1DConstraintFlag::eOUTPUT_FORCE;
+	c.geometricError = 0.0f;
+	c.velocityTarget = 0.0f;
+	c.minImpulse = -PX_MAX_F32;
+	c.maxImpulse = PX_MAX_F32;
+
+	c.linear0 = PxVec3(0.0f);
+	c.angular0 = frames.joint[0].q.getBasisVector0() * data.radius;
+	c.linear1 = frames.joint[1].q.getBasisVector0();
+	c.angular1 = PxVec3(0.0f);
+
+	return 1;
+}
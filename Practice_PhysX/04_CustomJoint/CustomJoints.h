@@ -0,0 +1,67 @@
+#pragma once
+
+#include <PxPhysicsAPI.h>
+
+#include "CustomConstraint.h"
+
+/*
+	CustomConstraint   Ʈ. Ʈ  x  ȸ / ̵ .
+
+	PulleyTraits		: PulleyJoint   . |joint0 - attachment0| + |joint1 - attachment1| * ratio = distance
+	GearTraits			:  ٵ ȸ ӵ ´.	ratio * w0.axis0 + w1.axis1 = 0
+	RackAndPinionTraits	: ǴϾ(body0) ȸ (body1) ̵ ´.	radius * w0.axis0 = v1.axis1
+
+	 ǴϾ ӵ Ƿ,  ٵ ȸ / ̵ PxRevoluteJoint / PxPrismaticJoint   Ƶд.
+
+	
+		PulleyConstraint* pulley = PulleyConstraint::Create(physics, body0, localFrame0, body1, localFrame1, PulleyTraits::Data{ att0, att1, distance, 1.0f });
+		GearConstraint* gear = GearConstraint::Create(physics, gear0, hingeFrame0, gear1, hingeFrame1, GearTraits::Data{ 2.0f });
+*/
+
+struct PulleyTraits : CustomConstraintTraits
+{
+	static const physx::PxU32 TYPE_ID = physx::PxConcreteType::eFIRST_USER_EXTENSION + 2;
+	static const char* GetTypeName() { return "PulleyConstraint"; }
+
+	struct Data
+	{
+		physx::PxVec3	attachment0;
+		physx::PxVec3	attachment1;
+		physx::PxReal	distance;
+		physx::PxReal	ratio;
+	};
+
+	static physx::PxU32 Prep(physx::Px1DConstraint* rows, physx::PxU32 maxRows, const Data& data, const CustomConstraintFrames& frames);
+	static void ShiftOrigin(Data& data, const physx::PxVec3& shift);
+	static void Visualize(physx::PxConstraintVisualizer& viz, const Data& data, const CustomConstraintFrames& frames);
+};
+
+struct GearTraits : CustomConstraintTraits
+{
+	static const physx::PxU32 TYPE_ID = physx::PxConcreteType::eFIRST_USER_EXTENSION + 3;
+	static const char* GetTypeName() { return "GearConstraint"; }
+
+	struct Data
+	{
+		physx::PxReal	ratio;		// body0    / body1   . w1 = -ratio * w0
+	};
+
+	static physx::PxU32 Prep(physx::Px1DConstraint* rows, physx::PxU32 maxRows, const Data& data, const CustomConstraintFrames& frames);
+};
+
+struct RackAndPinionTraits : CustomConstraintTraits
+{
+	static const physx::PxU32 TYPE_ID = physx::PxConcreteType::eFIRST_USER_EXTENSION + 4;
+	static const char* GetTypeName() { return "RackAndPinionConstraint"; }
+
+	struct Data
+	{
+		physx::PxReal	radius;		// ǴϾ .    2 * pi * radius ŭ δ.
+	};
+
+	static physx::PxU32 Prep(physx::Px1DConstraint* rows, physx::PxU32 maxRows, const Data& data, const CustomConstraintFrames& frames);
+};
+
+typedef CustomConstraint<PulleyTraits>			PulleyConstraint;
+typedef CustomConstraint<GearTraits>			GearConstraint;
+typedef CustomConstraint<RackAndPinionTraits>	RackAndPinionConstraint;
@@ -0,0 +1,266 @@
+#include "ImmediatePulley.h"
+
+using namespace physx;
+using namespace physx::immediate;
+
+PxU8* ImmediatePulleyWorld::BlockAllocator::Reserve(PxU32 byteSize)
+{
+	// ̹   PxSolveConstraints    ̸  ǹǷ, ڶ   δ.
+	const size_t size = (size_t(byteSize) + 15) & ~size_t(15);
+
+	while (m_Chunk < m_Chunks.size() && m_Used + size > m_Chunks[m_Chunk].size() - 16)
+	{
+		m_Chunk++;
+		m_Used = 0;
+	}
+
+	if (m_Chunk == m_Chunks.size())
+	{
+		m_Chunks.emplace_back((size > CHUNK_SIZE ? size : CHUNK_SIZE) + 16);
+	}
+
+	std::vector<PxU8>& chunk = m_Chunks[m_Chunk];
+	PxU8* base = reinterpret_cast<PxU8*>((reinterpret_cast<size_t>(chunk.data()) + 15) & ~size_t(15));
+	PxU8* block = base + m_Used;
+	m_Used += size;
+	return block;
+}
+
+void ImmediatePulleyWorld::EndTask::release()
+{
+	PxLightCpuTask::release();
+	SnippetUtils::syncSet(m_World->m_EndSync);
+}
+
+ImmediatePulleyWorld::ImmediatePulleyWorld()
+	: m_TaskManager(nullptr)
+	, m_EndSync(nullptr)
+	, m_NbPulleys(0)
+	, m_Gravity(0.0f, -9.81f, 0.0f)
+	, m_Dt(1.0f / 60.0f)
+	, m_PositionIterations(4)
+	, m_VelocityIterations(1)
+{
+	m_EndTask.m_World = this;
+}
+
+ImmediatePulleyWorld::~ImmediatePulleyWorld()
+{
+	Release();
+}
+
+void ImmediatePulleyWorld::Init(PxCpuDispatcher& dispatcher, PxU32 nbIslands)
+{
+	Release();
+
+	m_TaskManager = PxTaskManager::createTaskManager(PxGetFoundation().getErrorCallback(), &dispatcher);
+	m_EndSync = SnippetUtils::syncCreate();
+
+	m_Islands.resize(PxMax(nbIslands, 1u));
+	m_IslandTasks.resize(m_Islands.size());
+
+	for (size_t i = 0; i < m_Islands.size(); i++)
+	{
+		m_IslandTasks[i].m_World = this;
+		m_IslandTasks[i].m_Island = &m_Islands[i];
+	}
+}
+
+void ImmediatePulleyWorld::Release()
+{
+	m_Islands.clear();
+	m_IslandTasks.clear();
+	m_NbPulleys = 0;
+
+	if (m_EndSync)
+	{
+		SnippetUtils::syncRelease(m_EndSync);
+		m_EndSync = nullptr;
+	}
+
+	PX_RELEASE(m_TaskManager);
+}
+
+void ImmediatePulleyWorld::AddPulley(PxReal mass0, const PxVec3& halfExtents0, const PxTransform& pose0, const PxVec3& attachment0,
+	PxReal mass1, const PxVec3& halfExtents1, const PxTransform& pose1, const PxVec3& attachment1,
+	PxReal distance, PxReal ratio)
+{
+	PX_ASSERT(!m_Islands.empty());
+
+	Island& island = m_Islands[m_NbPulleys % m_Islands.size()];
+	m_NbPulleys++;
+
+	const PxReal masses[2] = { mass0, mass1 };
+	const PxVec3* halfExtents[2] = { &halfExtents0, &halfExtents1 };
+	const PxTransform* poses[2] = { &pose0, &pose1 };
+
+	for (PxU32 b = 0; b < 2; b++)
+	{
+		//   Ʈ. ٵ   ߽̹Ƿ  ߽  .
+		const PxVec3 extents = *halfExtents[b] * 2.0f;
+		const PxVec3 inertia = PxVec3(
+			extents.y * extents.y + extents.z * extents.z,
+			extents.x * extents.x + extents.z * extents.z,
+			extents.x * extents.x + extents.y * extents.y) * (masses[b] / 12.0f);
+
+		PxRigidBodyData data;
+		data.linearVelocity = PxVec3(0.0f);
+		data.invMass = 1.0f / masses[b];
+		data.angularVelocity = PxVec3(0.0f);
+		data.maxDepenetrationVelocity = PX_MAX_F32;
+		data.invInertia = PxVec3(1.0f / inertia.x, 1.0f / inertia.y, 1.0f / inertia.z);
+		data.maxContactImpulse = PX_MAX_F32;
+		data.body2World = *poses[b];
+		data.linearDamping = 0.05f;
+		data.angularDamping = 0.05f;
+		data.maxLinearVelocitySq = 100.0f * 100.0f;
+		data.maxAngularVelocitySq = 50.0f * 50.0f;
+		data.pad = 0;
+		island.rigidBodies.push_back(data);
+	}
+
+	//    .
+	island.joints.push_back(PulleyJoint::MakeImmediateData(
+		PxTransform(PxVec3(0.0f, halfExtents0.y, 0.0f)), attachment0,
+		PxTransform(PxVec3(0.0f, halfExtents1.y, 0.0f)), attachment1,
+		distance, ratio));
+}
+
+void ImmediatePulleyWorld::Step(PxReal dt)
+{
+	m_Dt = dt;
+
+	SnippetUtils::syncReset(m_EndSync);
+	m_EndTask.setContinuation(*m_TaskManager, nullptr);
+
+	for (IslandTask& it : m_IslandTasks)
+	{
+		it.setContinuation(*m_TaskManager, &m_EndTask);
+		it.removeReference();
+	}
+
+	m_EndTask.removeReference();
+	SnippetUtils::syncWait(m_EndSync);
+}
+
+void ImmediatePulleyWorld::StepIsland(Island& island)
+{
+	const PxU32 nbBodies = PxU32(island.rigidBodies.size());
+	const PxU32 nbJoints = PxU32(island.joints.size());
+
+	if (!nbJoints)
+	{
+		return;
+	}
+
+	const PxReal dt = m_Dt;
+	const PxReal invDt = 1.0f / dt;
+
+	island.solverBodyData.resize(nbBodies);
+	island.solverBodies.assign(nbBodies, PxSolverBody());
+	island.linearMotion.resize(nbBodies);
+	island.angularMotion.resize(nbBodies);
+	island.descs.resize(nbJoints);
+	island.orderedDescs.resize(nbJoints);
+	island.headers.resize(nbJoints);
+
+	// 1. ߷° 踦  ֹ ٵ
+	PxConstructSolverBodies(island.rigidBodies.data(), island.solverBodyData.data(), nbBodies, m_Gravity, dt);
+
+	// 2.  .  ٵ  Ƿ 4 δ.
+	for (PxU32 i = 0; i < nbJoints; i++)
+	{
+		PxSolverConstraintDesc& desc = island.descs[i];
+		desc.bodyA = &island.solverBodies[i * 2];
+		desc.bodyB = &island.solverBodies[i * 2 + 1];
+		desc.bodyADataIndex = i * 2;
+		desc.bodyBDataIndex = i * 2 + 1;
+		desc.linkIndexA = PxSolverConstraintDesc::NO_LINK;
+		desc.linkIndexB = PxSolverConstraintDesc::NO_LINK;
+		desc.writeBack = nullptr;
+		desc.writeBackLengthOver4 = 0;
+		desc.constraint = reinterpret_cast<PxU8*>(&island.joints[i]);	//     ã  .
+		desc.constraintLengthOver16 = PxSolverConstraintDesc::eJOINT_CONSTRAINT;
+	}
+
+	const PxU32 nbHeaders = PxBatchConstraints(island.descs.data(), nbJoints, island.solverBodies.data(), nbBodies,
+		island.headers.data(), island.orderedDescs.data());
+
+	// 3. PulleyJoint::SolverPrep    .
+	island.allocator.Reset();
+
+	for (PxU32 i = 0; i < nbHeaders; i++)
+	{
+		PxConstraintBatchHeader& header = island.headers[i];
+		header.constraintType = PxSolverConstraintDesc::eJOINT_CONSTRAINT;
+
+		PxSolverConstraintPrepDesc prepDescs[4];
+		PxImmediateConstraint constraints[4];
+
+		for (PxU32 j = 0; j < header.stride; j++)
+		{
+			PxSolverConstraintDesc& desc = island.orderedDescs[header.startIndex + j];
+			const PulleyJoint::PulleyJointData& joint = *reinterpret_cast<const PulleyJoint::PulleyJointData*>(desc.constraint);
+
+			PxSolverConstraintPrepDesc& prepDesc = prepDescs[j];
+			prepDesc.desc = &desc;
+			prepDesc.body0 = desc.bodyA;
+			prepDesc.body1 = desc.bodyB;
+			prepDesc.data0 = &island.solverBodyData[desc.bodyADataIndex];
+			prepDesc.data1 = &island.solverBodyData[desc.bodyBDataIndex];
+			prepDesc.bodyFrame0 = prepDesc.data0->body2World;
+			prepDesc.bodyFrame1 = prepDesc.data1->body2World;
+			prepDesc.bodyState0 = PxSolverConstraintPrepDescBase::eDYNAMIC_BODY;
+			prepDesc.bodyState1 = PxSolverConstraintPrepDescBase::eDYNAMIC_BODY;
+			prepDesc.invMassScales.linear0 = prepDesc.invMassScales.linear1 = 1.0f;
+			prepDesc.invMassScales.angular0 = prepDesc.invMassScales.angular1 = 1.0f;
+			prepDesc.linBreakForce = PX_MAX_F32;
+			prepDesc.angBreakForce = PX_MAX_F32;
+			prepDesc.minResponseThreshold = 0.0f;
+			prepDesc.writeback = nullptr;
+			prepDesc.disablePreprocessing = false;
+			prepDesc.improvedSlerp = false;
+			prepDesc.driveLimitsAreForces = false;
+			prepDesc.extendedLimits = false;
+
+			constraints[j] = PulleyJoint::GetImmediateConstraint(joint);
+		}
+
+		PxCreateJointConstraintsWithImmediateShaders(&header, 1, constraints, prepDescs, island.allocator, dt, invDt);
+	}
+
+	// 4. Ǯ     Է ´.
+	PxSolveConstraints(island.headers.data(), nbHeaders, island.orderedDescs.data(), island.solverBodies.data(),
+		island.linearMotion.data(), island.angularMotion.data(), nbBodies, m_PositionIterations, m_VelocityIterations);
+
+	PxIntegrateSolverBodies(island.solverBodyData.data(), island.solverBodies.data(),
+		island.linearMotion.data(), island.angularMotion.data(), nbBodies, dt);
+
+	for (PxU32 i = 0; i < nbBodies; i++)
+	{
+		const PxSolverBodyData& data = island.solverBodyData[i];
+		PxRigidBodyData& body = island.rigidBodies[i];
+		body.linearVelocity = data.linearVelocity;
+		body.angularVelocity = data.angularVelocity;
+		body.body2World = data.body2World;
+	}
+}
+
+PxTransform ImmediatePulleyWorld::GetBodyPose(PxU32 pulley, PxU32 body) const
+{
+	const Island& island = m_Islands[pulley % m_Islands.size()];
+	return island.rigidBodies[(pulley / m_Islands.size()) * 2 + body].body2World;
+}
+
+PxVec3 ImmediatePulleyWorld::GetAttachment(PxU32 pulley, PxU32 body) const
+{
+	const Island& island = m_Islands[pulley % m_Islands.size()];
+	const PulleyJoint::PulleyJointData& joint = island.joints[pulley / m_Islands.size()];
+	return body == 0 ? joint.attachment0 : joint.attachment1;
+}
+
+PxReal ImmediatePulleyWorld::GetDistance(PxU32 pulley) const
+{
+	const Island& island = m_Islands[pulley % m_Islands.size()];
+	return island.joints[pulley / m_Islands.size()].distance;
+}
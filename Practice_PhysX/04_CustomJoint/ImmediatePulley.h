@@ -0,0 +1,123 @@
+#pragma once
+
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+#include <PxImmediateMode.h>
+
+#include "SnippetUtils.h"
+
+#include "PulleyJoint.h"
+
+/*
+	       ý   ϳ׽.  ̳ "࿡" ùķ̼ǿ̴.
+
+	 ϳ ̳ ٵ   PulleyJoint  ϳ ̷, 浹 .
+	ý۵ (island)   ½ũ ϳ    .
+		PxConstructSolverBodies -> PxBatchConstraints -> PxCreateJointConstraintsWithImmediateShaders
+		-> PxSolveConstraints -> PxIntegrateSolverBodies
+	 ϴ Ͱ Ƿ  .
+
+	
+		ImmediatePulleyWorld world;
+		world.Init(dispatcher, nbIslands);
+		world.AddPulley(mass0, halfExtent0, pose0, attachment0, mass1, halfExtent1, pose1, attachment1, distance);
+		world.Step(dt);		//     ٸ.
+		world.Release();
+*/
+
+class ImmediatePulleyWorld
+{
+public:
+	ImmediatePulleyWorld();
+	~ImmediatePulleyWorld();
+
+	void Init(physx::PxCpuDispatcher& dispatcher, physx::PxU32 nbIslands);
+	void Release();
+
+	//     մ´.  ʷ ư ִ´.
+	void AddPulley(physx::PxReal mass0, const physx::PxVec3& halfExtents0, const physx::PxTransform& pose0, const physx::PxVec3& attachment0,
+		physx::PxReal mass1, const physx::PxVec3& halfExtents1, const physx::PxTransform& pose1, const physx::PxVec3& attachment1,
+		physx::PxReal distance, physx::PxReal ratio = 1.0f);
+
+	void Step(physx::PxReal dt);
+
+	void SetGravity(const physx::PxVec3& gravity) { m_Gravity = gravity; }
+	void SetIterations(physx::PxU32 position, physx::PxU32 velocity) { m_PositionIterations = position; m_VelocityIterations = velocity; }
+
+	physx::PxU32		GetNbPulleys() const { return m_NbPulleys; }
+	physx::PxTransform	GetBodyPose(physx::PxU32 pulley, physx::PxU32 body) const;
+	physx::PxVec3		GetAttachment(physx::PxU32 pulley, physx::PxU32 body) const;
+	physx::PxReal		GetDistance(physx::PxU32 pulley) const;
+
+private:
+	// PxCreateJointConstraintsWithImmediateShaders    ͸ ´.   ó ٽ .
+	class BlockAllocator : public physx::PxConstraintAllocator
+	{
+	public:
+		void Reset() { m_Chunk = 0; m_Used = 0; }
+
+		virtual physx::PxU8* reserveConstraintData(const physx::PxU32 byteSize) override { return Reserve(byteSize); }
+		virtual physx::PxU8* reserveFrictionData(const physx::PxU32 byteSize) override { return Reserve(byteSize); }
+
+	private:
+		physx::PxU8* Reserve(physx::PxU32 byteSize);
+
+		static const size_t CHUNK_SIZE = 64 * 1024;
+
+		std::vector<std::vector<physx::PxU8>>	m_Chunks;
+		size_t									m_Chunk = 0;
+		size_t									m_Used = 0;
+	};
+
+	struct Island
+	{
+		std::vector<physx::immediate::PxRigidBodyData>	rigidBodies;	//  i  ٵ 2i, 2i + 1
+		std::vector<PulleyJoint::PulleyJointData>		joints;
+
+		std::vector<physx::PxSolverBodyData>			solverBodyData;
+		std::vector<physx::PxSolverBody>				solverBodies;
+		std::vector<physx::PxSolverConstraintDesc>		descs;
+		std::vector<physx::PxSolverConstraintDesc>		orderedDescs;
+		std::vector<physx::PxConstraintBatchHeader>		headers;
+		std::vector<physx::PxVec3>						linearMotion;
+		std::vector<physx::PxVec3>						angularMotion;
+
+		BlockAllocator									allocator;
+	};
+
+	class IslandTask : public physx::PxLightCpuTask
+	{
+	public:
+		virtual void		run() override { m_World->StepIsland(*m_Island); }
+		virtual const char*	getName() const override { return "ImmediatePulleyWorld::IslandTask"; }
+
+		ImmediatePulleyWorld*	m_World;
+		Island*					m_Island;
+	};
+
+	class EndTask : public physx::PxLightCpuTask
+	{
+	public:
+		virtual void		run() override {}
+		virtual void		release() override;
+		virtual const char*	getName() const override { return "ImmediatePulleyWorld::EndTask"; }
+
+		ImmediatePulleyWorld*	m_World;
+	};
+
+	void StepIsland(Island& island);
+
+private:
+	physx::PxTaskManager*		m_TaskManager;
+	std::vector<Island>			m_Islands;
+	std::vector<IslandTask>		m_IslandTasks;
+	EndTask						m_EndTask;
+	physx::SnippetUtils::Sync*	m_EndSync;
+
+	physx::PxU32	m_NbPulleys;
+	physx::PxVec3	m_Gravity;
+	physx::PxReal	m_Dt;
+	physx::PxU32	m_PositionIterations;
+	physx::PxU32	m_VelocityIterations;
+};
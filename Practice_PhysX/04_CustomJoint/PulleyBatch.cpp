@@ -0,0 +1,364 @@
+#include "PulleyBatch.h"
+
+#if PX_SSE2
+#include <xmmintrin.h>
+#endif
+
+#include "SnippetUtils.h"
+
+using namespace physx;
+
+PxConstraintShaderTable PulleyBatch::m_ShaderTable = {
+	&PulleyBatch::SolverPrep,
+	&PulleyBatch::Project,
+	&PulleyBatch::Visualize,
+	PxConstraintFlag::Enum(0) };
+
+PulleyBatch::PulleyBatch(PxPhysics& physics)
+	: m_Physics(&physics)
+	, m_GatherMs(0.0f)
+	, m_PrepareMs(0.0f)
+{
+}
+
+PulleyBatch::~PulleyBatch()
+{
+	Release();
+}
+
+PxU32 PulleyBatch::Add(PxRigidBody& body0, const PxTransform& localFrame0, const PxVec3& attachment0,
+	PxRigidBody& body1, const PxTransform& localFrame1, const PxVec3& attachment1,
+	PxReal distance, PxReal ratio)
+{
+	const PxU32 index = GetNbPulleys();
+
+	//   LANES  ä  ֵ ø. ĭ 길 ǰ  ʴ´.
+	Resize((index + LANES) & ~(LANES - 1));
+
+	m_Bodies[0].push_back(&body0);
+	m_Bodies[1].push_back(&body1);
+
+	m_LocalJoint[0].Set(index, localFrame0.p);
+	m_LocalJoint[1].Set(index, localFrame1.p);
+	m_LocalCom[0].Set(index, body0.getCMassLocalPose().p);
+	m_LocalCom[1].Set(index, body1.getCMassLocalPose().p);
+	m_Attachment[0].Set(index, attachment0);
+	m_Attachment[1].Set(index, attachment1);
+	m_Distance[index] = distance;
+	m_Ratio[index] = ratio;
+
+	Connector* connector = new Connector(*this, index);
+	connector->m_Constraint = m_Physics->createConstraint(&body0, &body1, *connector, m_ShaderTable, sizeof(Connector::Block));
+	m_Connectors.push_back(connector);
+
+	return index;
+}
+
+void PulleyBatch::Release()
+{
+	// Ŀʹ onConstraintRelease   .
+	for (Connector* it : m_Connectors)
+	{
+		it->m_Constraint->release();
+	}
+
+	m_Connectors.clear();
+	m_Bodies[0].clear();
+	m_Bodies[1].clear();
+	Resize(0);
+}
+
+void PulleyBatch::Resize(size_t size)
+{
+	for (PxU32 i = 0; i < 2; i++)
+	{
+		m_LocalJoint[i].Resize(size);
+		m_LocalCom[i].Resize(size);
+		m_Attachment[i].Resize(size);
+		m_Rotation[i].Resize(size);
+		m_Position[i].Resize(size);
+	}
+
+	m_Distance.resize(size, 0.0f);
+	m_Ratio.resize(size, 1.0f);
+	m_Results.resize(size);
+}
+
+void PulleyBatch::Prepare()
+{
+	PxU64 start = SnippetUtils::getCurrentTimeCounterValue();
+	Gather();
+	m_GatherMs = SnippetUtils::getElapsedTimeInMilliseconds(SnippetUtils::getCurrentTimeCounterValue() - start);
+
+	start = SnippetUtils::getCurrentTimeCounterValue();
+	const PxU32 size = PxU32(m_Results.size());
+
+#if PX_SSE2
+	for (PxU32 i = 0; i < size; i += LANES)
+	{
+		PrepareSIMD(i);
+	}
+#else
+	for (PxU32 i = 0; i < size; i++)
+	{
+		PrepareScalar(i);
+	}
+#endif
+
+	m_PrepareMs = SnippetUtils::getElapsedTimeInMilliseconds(SnippetUtils::getCurrentTimeCounterValue() - start);
+}
+
+void PulleyBatch::Gather()
+{
+	const PxU32 nbPulleys = GetNbPulleys();
+
+	for (PxU32 b = 0; b < 2; b++)
+	{
+		for (PxU32 i = 0; i < nbPulleys; i++)
+		{
+			const PxTransform pose = m_Bodies[b][i]->getGlobalPose();
+			m_Rotation[b].Set(i, pose.q);
+			m_Position[b].Set(i, pose.p);
+		}
+	}
+}
+
+// PulleyJoint::SolverPrep   . SIMD    ,  񱳿ε ܵд.
+void PulleyBatch::PrepareScalar(PxU32 index)
+{
+	PxVec3 joint[2];
+	PxVec3 com[2];
+	PxVec3 direction[2];
+	PxReal length[2];
+
+	for (PxU32 b = 0; b < 2; b++)
+	{
+		const PxTransform pose(m_Position[b].Get(index),
+			PxQuat(m_Rotation[b].x[index], m_Rotation[b].y[index], m_Rotation[b].z[index], m_Rotation[b].w[index]));
+
+		joint[b] = pose.transform(m_LocalJoint[b].Get(index));
+		com[b] = pose.transform(m_LocalCom[b].Get(index));
+		direction[b] = m_Attachment[b].Get(index) - joint[b];
+		length[b] = direction[b].normalize();
+	}
+
+	Result& result = m_Results[index];
+	result.geometricError = m_Distance[index] - (length[0] + length[1] * m_Ratio[index]);
+	result.linear0 = direction[0];
+	result.angular0 = (joint[0] - com[0]).cross(direction[0]);
+	result.linear1 = -direction[1];
+	result.angular1 = (joint[1] - com[1]).cross(result.linear1);
+	result.joint0 = joint[0];
+	result.joint1 = joint[1];
+	result.body0WorldOffset = joint[1] - com[0];
+}
+
+#if PX_SSE2
+namespace
+{
+	struct Vec4x3
+	{
+		__m128 x, y, z;
+	};
+
+	PX_FORCE_INLINE Vec4x3 V3Load(const PxReal* x, const PxReal* y, const PxReal* z)
+	{
+		Vec4x3 v = { _mm_loadu_ps(x), _mm_loadu_ps(y), _mm_loadu_ps(z) };
+		return v;
+	}
+
+	PX_FORCE_INLINE Vec4x3 V3Add(const Vec4x3& a, const Vec4x3& b)
+	{
+		Vec4x3 v = { _mm_add_ps(a.x, b.x), _mm_add_ps(a.y, b.y), _mm_add_ps(a.z, b.z) };
+		return v;
+	}
+
+	PX_FORCE_INLINE Vec4x3 V3Sub(const Vec4x3& a, const Vec4x3& b)
+	{
+		Vec4x3 v = { _mm_sub_ps(a.x, b.x), _mm_sub_ps(a.y, b.y), _mm_sub_ps(a.z, b.z) };
+		return v;
+	}
+
+	PX_FORCE_INLINE Vec4x3 V3Scale(const Vec4x3& a, __m128 s)
+	{
+		Vec4x3 v = { _mm_mul_ps(a.x, s), _mm_mul_ps(a.y, s), _mm_mul_ps(a.z, s) };
+		return v;
+	}
+
+	PX_FORCE_INLINE Vec4x3 V3Cross(const Vec4x3& a, const Vec4x3& b)
+	{
+		Vec4x3 v =
+		{
+			_mm_sub_ps(_mm_mul_ps(a.y, b.z), _mm_mul_ps(a.z, b.y)),
+			_mm_sub_ps(_mm_mul_ps(a.z, b.x), _mm_mul_ps(a.x, b.z)),
+			_mm_sub_ps(_mm_mul_ps(a.x, b.y), _mm_mul_ps(a.y, b.x)),
+		};
+		return v;
+	}
+
+	PX_FORCE_INLINE __m128 V3Dot(const Vec4x3& a, const Vec4x3& b)
+	{
+		return _mm_add_ps(_mm_add_ps(_mm_mul_ps(a.x, b.x), _mm_mul_ps(a.y, b.y)), _mm_mul_ps(a.z, b.z));
+	}
+
+	// PxQuat::rotate   . t = 2 * (q x v), v' = v + w * t + q x t
+	PX_FORCE_INLINE Vec4x3 V3Rotate(const Vec4x3& q, __m128 w, const Vec4x3& v)
+	{
+		const Vec4x3 t = V3Scale(V3Cross(q, v), _mm_set1_ps(2.0f));
+		return V3Add(V3Add(v, V3Scale(t, w)), V3Cross(q, t));
+	}
+
+	PX_FORCE_INLINE void V3Store(const Vec4x3& v, PxVec3* out, size_t stride)
+	{
+		PX_ALIGN(16, PxReal x[4]);
+		PX_ALIGN(16, PxReal y[4]);
+		PX_ALIGN(16, PxReal z[4]);
+		_mm_store_ps(x, v.x);
+		_mm_store_ps(y, v.y);
+		_mm_store_ps(z, v.z);
+
+		for (PxU32 i = 0; i < 4; i++)
+		{
+			PxVec3& it = *reinterpret_cast<PxVec3*>(reinterpret_cast<PxU8*>(out) + stride * i);
+			it = PxVec3(x[i], y[i], z[i]);
+		}
+	}
+}
+
+void PulleyBatch::PrepareSIMD(PxU32 index)
+{
+	Vec4x3 joint[2];
+	Vec4x3 com[2];
+	Vec4x3 direction[2];
+	__m128 length[2];
+
+	for (PxU32 b = 0; b < 2; b++)
+	{
+		const QuatColumn& rotation = m_Rotation[b];
+		const Vec4x3 q = V3Load(&rotation.x[index], &rotation.y[index], &rotation.z[index]);
+		const __m128 w = _mm_loadu_ps(&rotation.w[index]);
+		const Vec4x3 p = V3Load(&m_Position[b].x[index], &m_Position[b].y[index], &m_Position[b].z[index]);
+
+		joint[b] = V3Add(p, V3Rotate(q, w, V3Load(&m_LocalJoint[b].x[index], &m_LocalJoint[b].y[index], &m_LocalJoint[b].z[index])));
+		com[b] = V3Add(p, V3Rotate(q, w, V3Load(&m_LocalCom[b].x[index], &m_LocalCom[b].y[index], &m_LocalCom[b].z[index])));
+
+		// normalize()ó ̰ 0̸ ⵵ 0 д.
+		const Vec4x3 d = V3Sub(V3Load(&m_Attachment[b].x[index], &m_Attachment[b].y[index], &m_Attachment[b].z[index]), joint[b]);
+		length[b] = _mm_sqrt_ps(V3Dot(d, d));
+		const __m128 valid = _mm_cmpgt_ps(length[b], _mm_setzero_ps());
+		direction[b] = V3Scale(d, _mm_and_ps(valid, _mm_div_ps(_mm_set1_ps(1.0f), length[b])));
+	}
+
+	const __m128 total = _mm_add_ps(length[0], _mm_mul_ps(length[1], _mm_loadu_ps(&m_Ratio[index])));
+	const __m128 error = _mm_sub_ps(_mm_loadu_ps(&m_Distance[index]), total);
+
+	const Vec4x3 linear1 = V3Scale(direction[1], _mm_set1_ps(-1.0f));
+
+	Result* results = &m_Results[index];
+	const size_t stride = sizeof(Result);
+	V3Store(direction[0], &results->linear0, stride);
+	V3Store(V3Cross(V3Sub(joint[0], com[0]), direction[0]), &results->angular0, stride);
+	V3Store(linear1, &results->linear1, stride);
+	V3Store(V3Cross(V3Sub(joint[1], com[1]), linear1), &results->angular1, stride);
+	V3Store(joint[0], &results->joint0, stride);
+	V3Store(joint[1], &results->joint1, stride);
+	V3Store(V3Sub(joint[1], com[0]), &results->body0WorldOffset, stride);
+
+	PX_ALIGN(16, PxReal errors[4]);
+	_mm_store_ps(errors, error);
+
+	for (PxU32 i = 0; i < LANES; i++)
+	{
+		results[i].geometricError = errors[i];
+	}
+}
+#else
+void PulleyBatch::PrepareSIMD(PxU32 index)
+{
+	for (PxU32 i = 0; i < LANES; i++)
+	{
+		PrepareScalar(index + i);
+	}
+}
+#endif
+
+/////////////////////////////////
+
+void PulleyBatch::Connector::onComShift(PxU32 actor)
+{
+	const PxU32 index = m_Block.index;
+	m_Batch->m_LocalCom[actor].Set(index, m_Batch->m_Bodies[actor][index]->getCMassLocalPose().p);
+}
+
+void PulleyBatch::Connector::onOriginShift(const PxVec3& shift)
+{
+	const PxU32 index = m_Block.index;
+
+	for (PxU32 b = 0; b < 2; b++)
+	{
+		m_Batch->m_Attachment[b].Set(index, m_Batch->m_Attachment[b].Get(index) - shift);
+	}
+}
+
+/////////////////////////////////
+
+PxU32 PulleyBatch::SolverPrep(
+	Px1DConstraint* constraints,
+	PxVec3& body0WorldOffset,
+	PxU32,
+	PxConstraintInvMassScale&,
+	const void* constantBlock,
+	const PxTransform&,
+	const PxTransform&,
+	bool,
+	PxVec3& body0WorldOut,
+	PxVec3& body1WorldOut)
+{
+	// ٵ  Prepare  ̹ Ƿ  .
+	const Connector::Block& block = *reinterpret_cast<const Connector::Block*>(constantBlock);
+	const Result& result = block.batch->m_Results[block.index];
+
+	body0WorldOut = result.joint0;
+	body1WorldOut = result.joint1;
+	body0WorldOffset = result.body0WorldOffset;
+
+	Px1DConstraint* c = constraints;
+	c->flags = Px1DConstraintFlag::eOUTPUT_FORCE;
+
+	if (result.geometricError < 0.0f)
+	{
+		c->maxImpulse = PX_MAX_F32;
+		c->minImpulse = 0;
+		c->geometricError = result.geometricError;
+	}
+	else if (result.geometricError > 0.0f)
+	{
+		c->maxImpulse = 0;
+		c->minImpulse = -PX_MAX_F32;
+		c->geometricError = result.geometricError;
+	}
+
+	c->linear0 = result.linear0;
+	c->angular0 = result.angular0;
+	c->linear1 = result.linear1;
+	c->angular1 = result.angular1;
+
+	return 1;
+}
+
+void PulleyBatch::Visualize(PxConstraintVisualizer& viz,
+	const void* constantBlock,
+	const PxTransform&,
+	const PxTransform&, PxU32)
+{
+	const Connector::Block& block = *reinterpret_cast<const Connector::Block*>(constantBlock);
+	const PulleyBatch& batch = *block.batch;
+	const Result& result = batch.m_Results[block.index];
+
+	viz.visualizeLine(result.joint0, batch.m_Attachment[0].Get(block.index), 0xff000000);
+	viz.visualizeLine(result.joint1, batch.m_Attachment[1].Get(block.index), 0xff000000);
+}
+
+void PulleyBatch::Project(const void*, PxTransform&, PxTransform&, bool)
+{
+}
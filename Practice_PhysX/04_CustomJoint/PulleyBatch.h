@@ -0,0 +1,166 @@
+#pragma once
+
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+
+/*
+	PulleyJoint    õ~  Ѳ ٷ ġ.
+
+	PulleyJoint  SolverPrep ȿ  PxTransform  normalize()   Ѵ.
+	ġ  ͸ SoA 迭 , simulate  Prepare()   ֹ Է
+	4 SIMD  ̸ صд. ึ Ҹ SolverPrep   ε  縸 Ѵ.
+
+	ֹ SolverPrep  ѱ ٵ  fetchResults  ٵ  Ƿ,
+	simulate    ص  . ׷ Prepare  simulate ̿ ٵ ű  ȴ.
+	 ٵ ϸ,  ϳ   .
+
+	
+		PulleyBatch batch(physics);
+		batch.Add(body0, localFrame0, attachment0, body1, localFrame1, attachment1, distance, ratio);
+		...
+		 	: batch.Prepare(); scene->simulate(dt); scene->fetchResults(true);
+*/
+
+class PulleyBatch
+{
+public:
+	static const physx::PxU32 TYPE_ID = physx::PxConcreteType::eFIRST_USER_EXTENSION + 1;
+	static const physx::PxU32 LANES = 4;
+
+public:
+	explicit PulleyBatch(physx::PxPhysics& physics);
+	~PulleyBatch();
+
+	//  ȣ ش.
+	physx::PxU32 Add(physx::PxRigidBody& body0, const physx::PxTransform& localFrame0, const physx::PxVec3& attachment0,
+		physx::PxRigidBody& body1, const physx::PxTransform& localFrame1, const physx::PxVec3& attachment1,
+		physx::PxReal distance, physx::PxReal ratio = 1.0f);
+
+	void Release();
+
+	// simulate   忡 ȣ.
+	void Prepare();
+
+	void			SetDistance(physx::PxU32 index, physx::PxReal distance) { m_Distance[index] = distance; }
+	physx::PxReal	GetDistance(physx::PxU32 index) const { return m_Distance[index]; }
+
+	physx::PxU32	GetNbPulleys() const { return physx::PxU32(m_Connectors.size()); }
+	physx::PxReal	GetLastGatherMilliseconds() const { return m_GatherMs; }
+	physx::PxReal	GetLastPrepareMilliseconds() const { return m_PrepareMs; }
+
+private:
+	// ֹ ״     .
+	struct Result
+	{
+		physx::PxVec3	linear0;
+		physx::PxVec3	angular0;
+		physx::PxVec3	linear1;
+		physx::PxVec3	angular1;
+		physx::PxVec3	joint0;			// body0WorldOut
+		physx::PxVec3	joint1;			// body1WorldOut
+		physx::PxVec3	body0WorldOffset;
+		physx::PxReal	geometricError;
+	};
+
+	struct Vec3Column
+	{
+		std::vector<physx::PxReal> x, y, z;
+
+		void Resize(size_t size) { x.resize(size, 0.0f); y.resize(size, 0.0f); z.resize(size, 0.0f); }
+		void Set(physx::PxU32 i, const physx::PxVec3& v) { x[i] = v.x; y[i] = v.y; z[i] = v.z; }
+		physx::PxVec3 Get(physx::PxU32 i) const { return physx::PxVec3(x[i], y[i], z[i]); }
+	};
+
+	struct QuatColumn
+	{
+		std::vector<physx::PxReal> x, y, z, w;
+
+		void Resize(size_t size) { x.resize(size, 0.0f); y.resize(size, 0.0f); z.resize(size, 0.0f); w.resize(size, 1.0f); }
+		void Set(physx::PxU32 i, const physx::PxQuat& q) { x[i] = q.x; y[i] = q.y; z[i] = q.z; w[i] = q.w; }
+	};
+
+	// PhysX  ึ 䱸ϴ Ŀ.  Ͽ ġ ȣ д.
+	class Connector : public physx::PxConstraintConnector
+	{
+	public:
+		Connector(PulleyBatch& batch, physx::PxU32 index) : m_Batch(&batch), m_Constraint(nullptr) { m_Block.batch = &batch; m_Block.index = index; }
+
+		struct Block
+		{
+			const PulleyBatch*	batch;
+			physx::PxU32		index;
+		};
+
+		virtual void*	prepareData() override { return &m_Block; }
+		virtual void	onConstraintRelease() override { delete this; }
+		virtual void	onComShift(physx::PxU32 actor) override;
+		virtual void	onOriginShift(const physx::PxVec3& shift) override;
+		virtual void*	getExternalReference(physx::PxU32& typeID) override { typeID = TYPE_ID; return this; }
+
+		virtual bool	updatePvdProperties(physx::pvdsdk::PvdDataStream&,
+						const physx::PxConstraint*,
+						physx::PxPvdUpdateType::Enum) const override { return true; }
+
+		virtual physx::PxBase* getSerializable() override { return NULL; }
+		virtual physx::PxConstraintSolverPrep getPrep() const override { return m_ShaderTable.solverPrep; }
+		virtual const void* getConstantBlock() const override { return &m_Block; }
+
+		PulleyBatch*			m_Batch;
+		Block					m_Block;
+		physx::PxConstraint*	m_Constraint;
+
+	private:
+		virtual ~Connector() {}
+	};
+
+	void Gather();
+	void PrepareScalar(physx::PxU32 index);
+	void PrepareSIMD(physx::PxU32 index);
+	void Resize(size_t size);
+
+	static physx::PxU32 SolverPrep(physx::Px1DConstraint* constraints,
+		physx::PxVec3& body0WorldOffset,
+		physx::PxU32 maxConstraints,
+		physx::PxConstraintInvMassScale&,
+		const void* constantBlock,
+		const physx::PxTransform& body0World,
+		const physx::PxTransform& body1World,
+		bool useExtendedLimits,
+		physx::PxVec3& body0WorldOut, physx::PxVec3& body1WorldOut);
+
+	static void	Visualize(physx::PxConstraintVisualizer& viz,
+		const void* constantBlock,
+		const physx::PxTransform& body0Transform,
+		const physx::PxTransform& body1Transform,
+		physx::PxU32 flags);
+
+	static void Project(const void* constantBlock,
+		physx::PxTransform& bodyAToWorld,
+		physx::PxTransform& bodyBToWorld,
+		bool projectToA);
+
+private:
+	physx::PxPhysics*	m_Physics;
+
+	std::vector<Connector*>				m_Connectors;
+	std::vector<physx::PxRigidBody*>	m_Bodies[2];
+
+	//   . 迭 ̴ LANES   .
+	Vec3Column					m_LocalJoint[2];	//   
+	Vec3Column					m_LocalCom[2];		//    ߽
+	Vec3Column					m_Attachment[2];
+	std::vector<physx::PxReal>	m_Distance;
+	std::vector<physx::PxReal>	m_Ratio;
+
+	// Gather    ä  .
+	QuatColumn					m_Rotation[2];
+	Vec3Column					m_Position[2];
+
+	std::vector<Result>			m_Results;
+
+	physx::PxReal	m_GatherMs;
+	physx::PxReal	m_PrepareMs;
+
+	static physx::PxConstraintShaderTable m_ShaderTable;
+};
@@ -13,6 +13,7 @@ PxConstraintShaderTable PulleyJoint::m_ShaderTable = {
 PulleyJoint::PulleyJoint(PxPhysics& physics, 
 	PxRigidBody& body0, const PxTransform& localFrame0, const PxVec3& attachment0, 
 	PxRigidBody& body1, const PxTransform& localFrame1, const PxVec3& attachment1)
+	: PxBase(TYPE_ID, PxBaseFlag::eOWNS_MEMORY | PxBaseFlag::eIS_RELEASABLE)
 {
 	m_Constraint = physics.createConstraint(
 		&body0, &body1, 
@@ -35,6 +36,29 @@ PulleyJoint::PulleyJoint(PxPhysics& physics,
 	m_Data.localJointPoint[1] = body1.getCMassLocalPose().transformInv(m_LocalOffset[1]);
 }
 
+PulleyJoint::PulleyJointData PulleyJoint::MakeImmediateData(
+	const PxTransform& bodyFrame0, const PxVec3& attachment0,
+	const PxTransform& bodyFrame1, const PxVec3& attachment1,
+	PxReal distance, PxReal ratio)
+{
+	PulleyJointData data;
+	data.localJointPoint[0] = bodyFrame0.getNormalized();
+	data.localJointPoint[1] = bodyFrame1.getNormalized();
+	data.attachment0 = attachment0;
+	data.attachment1 = attachment1;
+	data.distance = distance;
+	data.ratio = ratio;
+	return data;
+}
+
+immediate::PxImmediateConstraint PulleyJoint::GetImmediateConstraint(const PulleyJointData& data)
+{
+	immediate::PxImmediateConstraint constraint;
+	constraint.prep = &PulleyJoint::SolverPrep;
+	constraint.constantBlock = &data;
+	return constraint;
+}
+
 void PulleyJoint::Release()
 {
 	m_Constraint->release();
@@ -93,7 +117,15 @@ void* PulleyJoint::prepareData()
 
 void PulleyJoint::onConstraintRelease()
 {
-	delete this;
+	// ȭ Ʈ ÷ ޸  ȿ Ƿ Ҹڸ θ.
+	if (getBaseFlags() & PxBaseFlag::eOWNS_MEMORY)
+	{
+		delete this;
+	}
+	else
+	{
+		this->~PulleyJoint();
+	}
 }
 
 void PulleyJoint::onComShift(PxU32 actor)
@@ -117,6 +149,54 @@ void* PulleyJoint::getExternalReference(PxU32& typeID)
 
 /////////////////////////////////
 
+void PulleyJoint::requiresObjects(PxProcessPxBaseCallback& c)
+{
+	c.process(*m_Constraint);
+
+	for (PxU32 i = 0; i < 2; i++)
+	{
+		c.process(*m_Body[i]);
+	}
+}
+
+void PulleyJoint::resolveReferences(PxDeserializationContext& context)
+{
+	context.translatePxBase(m_Constraint);
+	context.translatePxBase(m_Body[0]);
+	context.translatePxBase(m_Body[1]);
+
+	//  PxConstraint  ĿͿ ̴ ̺ ٽ Ǵ.
+	m_Constraint->setConstraintFunctions(*this, m_ShaderTable);
+}
+
+PulleyJoint* PulleyJoint::createObject(PxU8*& address, PxDeserializationContext& context)
+{
+	PulleyJoint* joint = new (address) PulleyJoint(PxBaseFlag::eIS_RELEASABLE);
+	address += sizeof(PulleyJoint);
+	joint->importExtraData(context);
+	joint->resolveReferences(context);
+	return joint;
+}
+
+void PulleyJoint::getBinaryMetaData(PxOutputStream& stream)
+{
+	PX_DEF_BIN_METADATA_CLASS(stream, PulleyJointData)
+	PX_DEF_BIN_METADATA_ITEMS_AUTO(stream, PulleyJointData, PxTransform, localJointPoint, 0)
+	PX_DEF_BIN_METADATA_ITEM(stream, PulleyJointData, PxVec3, attachment0, 0)
+	PX_DEF_BIN_METADATA_ITEM(stream, PulleyJointData, PxVec3, attachment1, 0)
+	PX_DEF_BIN_METADATA_ITEM(stream, PulleyJointData, PxReal, distance, 0)
+	PX_DEF_BIN_METADATA_ITEM(stream, PulleyJointData, PxReal, ratio, 0)
+
+	PX_DEF_BIN_METADATA_VCLASS(stream, PulleyJoint)
+	PX_DEF_BIN_METADATA_BASE_CLASS(stream, PulleyJoint, PxBase)
+	PX_DEF_BIN_METADATA_BASE_CLASS(stream, PulleyJoint, PxConstraintConnector)
+
+	PX_DEF_BIN_METADATA_ITEM(stream, PulleyJoint, PulleyJointData, m_Data, 0)
+	PX_DEF_BIN_METADATA_ITEMS(stream, PulleyJoint, PxRigidBody, m_Body, PxMetaDataFlag::ePTR, 2)
+	PX_DEF_BIN_METADATA_ITEMS_AUTO(stream, PulleyJoint, PxTransform, m_LocalOffset, 0)
+	PX_DEF_BIN_METADATA_ITEM(stream, PulleyJoint, PxConstraint, m_Constraint, PxMetaDataFlag::ePTR)
+}
+
 PxU32 PulleyJoint::SolverPrep(
 	Px1DConstraint* constraints, 
 	PxVec3& body0WorldOffset,
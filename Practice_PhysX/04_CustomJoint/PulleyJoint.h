@@ -1,6 +1,9 @@
 #pragma once
 
+#include <new>
+
 #include <PxPhysicsAPI.h>
+#include <PxImmediateMode.h>
 
 
 /*
@@ -19,21 +22,51 @@
 
 	  Ʈ  Ư ġ ϰ
 	   (distance ǥ) , е̷ ̴  .
+
+	       ü  ʰ MakeImmediateData / GetImmediateConstraint 
+	  SolverPrep  PxCreateJointConstraintsWithImmediateShaders  ѱ.
+
+	 PxBase ̱⵵ ϹǷ RegisterCustomJointSerializers  ϸ PxSerialization  ̳ʸ ÷ǿ   ִ.
+	 ٵ PxConstraint ʹ resolveReferences  ٽ ̾.
 */
 
 
 
-class PulleyJoint :public physx::PxConstraintConnector
+class PulleyJoint : public physx::PxBase, public physx::PxConstraintConnector
 {
 public:
 	static const physx::PxU32 TYPE_ID = physx::PxConcreteType::eFIRST_USER_EXTENSION;
 
+	struct PulleyJointData
+	{
+		physx::PxTransform localJointPoint[2];
+
+		physx::PxVec3 attachment0;
+		physx::PxVec3 attachment1;
+
+		physx::PxReal distance;
+		physx::PxReal ratio;
+	};
+
+	//  .   ٵ( ߽)  ̴.
+	static PulleyJointData MakeImmediateData(
+		const physx::PxTransform& bodyFrame0, const physx::PxVec3& attachment0,
+		const physx::PxTransform& bodyFrame1, const physx::PxVec3& attachment1,
+		physx::PxReal distance, physx::PxReal ratio = 1.0f);
+
+	// data  PxCreateJointConstraintsWithImmediateShaders     ־ Ѵ.
+	static physx::immediate::PxImmediateConstraint GetImmediateConstraint(const PulleyJointData& data);
+
 	PulleyJoint(physx::PxPhysics& physics,
 		physx::PxRigidBody& body0, const physx::PxTransform& localFrame0, const physx::PxVec3& attachment0,
 		physx::PxRigidBody& body1, const physx::PxTransform& localFrame1, const physx::PxVec3& attachment1);
 
 	void Release() ;
 
+	physx::PxConstraint*		GetConstraint() const { return m_Constraint; }	// ConstraintTelemetry    
+	physx::PxRigidBody*			GetBody(physx::PxU32 index) const { return m_Body[index]; }
+	const physx::PxTransform&	GetLocalFrame(physx::PxU32 index) const { return m_LocalOffset[index]; }
+
 	void			SetAttachment0(const physx::PxVec3& pos);
 	physx::PxVec3	GetAttachment0() const;
 
@@ -46,6 +79,26 @@ public:
 	void			SetRatio(physx::PxReal ratio);
 	physx::PxReal	GetRatio() const;
 
+public: // PxBase, ȭ
+	virtual void		release() override { Release(); }
+	virtual const char*	getConcreteTypeName() const override { return "PulleyJoint"; }
+
+	void		requiresObjects(physx::PxProcessPxBaseCallback& c);
+	void		exportExtraData(physx::PxSerializationContext&) {}
+	void		importExtraData(physx::PxDeserializationContext&) {}
+	void		resolveReferences(physx::PxDeserializationContext& context);
+	void		preExportDataReset() {}
+
+	static PulleyJoint*	createObject(physx::PxU8*& address, physx::PxDeserializationContext& context);
+	static void			getBinaryMetaData(physx::PxOutputStream& stream);
+
+protected:
+	virtual bool	isKindOf(const char* name) const override { return !::strcmp("PulleyJoint", name) || PxBase::isKindOf(name); }
+
+private:
+	// ȭ.  ̳ʸ ״ ä.
+	PulleyJoint(physx::PxBaseFlags baseFlags) : PxBase(baseFlags) {}
+
 private: //PxConstraintConnector Լ
 	virtual void*	prepareData() override;
 	virtual void	onConstraintRelease()override;
@@ -57,7 +110,7 @@ private: //PxConstraintConnector 
 					const physx::PxConstraint*,
 					physx::PxPvdUpdateType::Enum) const override {return true;}
 
-	physx::PxBase* getSerializable() override { return NULL; }
+	physx::PxBase* getSerializable() override { return this; }
 	virtual physx::PxConstraintSolverPrep getPrep() const override { return m_ShaderTable.solverPrep; }
 	virtual const void* getConstantBlock() const override { return &m_Data; }
 
@@ -85,17 +138,7 @@ private: //ConstraintShaderTable
 		bool projectToA);
 
 private:
-	struct PulleyJointData
-	{
-		physx::PxTransform localJointPoint[2];
-
-		physx::PxVec3 attachment0;
-		physx::PxVec3 attachment1;
-
-		physx::PxReal distance;
-		physx::PxReal ratio;
-
-	} m_Data;
+	PulleyJointData m_Data;
 
 	physx::PxRigidBody*		m_Body[2];
 	physx::PxTransform		m_LocalOffset[2];
@@ -0,0 +1,429 @@
+/*
+	 ۾(workload) SAP, MBP, ABP ε  ùķ̼ϰ
+	ε ð PxSimulationStatistics  /߰/  ǥ Ѵ.
+
+	- ε ð PhysX   ´. (   PhysX 忡 n/a)
+	  AABB Ŵ     ߻ϹǷ   Ѵ.
+	  ε ü  SAP  ߻ϹǷ MBP, ABP  n/a  ǥѴ.
+	    ð  CPU ð̶ ð ð ƴϴ.
+	- ۾  õ ϹǷ ε  ޶   .
+	-   ֿܼ Ѵ.
+*/
+
+#include "PxPhysicsAPI.h"
+
+#include "SnippetPrint.h"
+#include "SnippetUtils.h"
+
+#include "BroadPhaseRegionManager.h"
+#include "OutOfBoundsHandler.h"
+#include "ProfileZoneTimer.h"
+
+using namespace physx;
+
+PxDefaultAllocator		gAllocator;
+PxDefaultErrorCallback	gErrorCallback;
+
+PxFoundation* gFoundation = NULL;
+PxPhysics* gPhysics = NULL;
+
+PxDefaultCpuDispatcher* gDispatcher = NULL;
+PxScene* gScene = NULL;
+
+PxMaterial* gMaterial = NULL;
+
+ProfileZoneTimer gZoneTimer;
+PxU32 gAabbManagerZone = 0;
+PxU32 gBroadPhaseCoreZone = 0;
+
+// MBP     Ʈ ״ д. (ٸ ε   ϱ )
+OutOfBoundsHandler gOutOfBoundsHandler;
+BroadPhaseRegionManager gRegionManager;
+
+const PxU32 gWarmUpFrames = 30;
+const PxU32 gMeasureFrames = 200;
+
+//  ۾  ٿ ȿ .  ־   ʴ´.
+const PxBounds3 gWorldBounds(PxVec3(-200.0f, -10.0f, -200.0f), PxVec3(200.0f, 100.0f, 200.0f));
+
+enum Workload
+{
+	eSTATIC_HEAVY,		//   Ʈ + ణ  Ʈ
+	eDYNAMIC_HEAVY,		// ߿    Ʈ
+	ePROJECTILES,		//  Ʈ ̸  ƴٴϴ ߻ü
+	eCLUSTERED_STACKS,	//   ִ  õ
+
+	eWORKLOAD_COUNT
+};
+
+const char* gWorkloadNames[eWORKLOAD_COUNT] =
+{
+	"static-heavy",
+	"dynamic-heavy",
+	"projectiles",
+	"clustered-stacks",
+};
+
+const PxBroadPhaseType::Enum gBroadPhaseTypes[] =
+{
+	PxBroadPhaseType::eSAP,
+	PxBroadPhaseType::eMBP,
+	PxBroadPhaseType::eABP,
+};
+
+const char* gBroadPhaseNames[] =
+{
+	"SAP",
+	"MBP",
+	"ABP",
+};
+
+const PxU32 gNbBroadPhaseTypes = sizeof(gBroadPhaseTypes) / sizeof(gBroadPhaseTypes[0]);
+
+struct BenchmarkResult
+{
+	PxReal	aabbManagerMs;	// Ӵ 
+	PxReal	broadPhaseMs;	// Ӵ , ε ü
+	PxReal	simulateMs;		// Ӵ  (simulate + fetchResults)
+	PxU32	nbAdds;			//   հ
+	PxU32	nbRemoves;
+	PxU32	nbNewPairs;
+	PxU32	nbLostPairs;
+	PxU32	maxPairs;		// Ӵ ִ ο  
+	bool	hasAabbManagerZones;
+	bool	hasBroadPhaseZones;
+};
+
+// ۾  . ׻    .
+class Random
+{
+public:
+	explicit Random(PxU32 seed) : m_State(seed) {}
+
+	PxReal Next()
+	{
+		m_State ^= m_State << 13;
+		m_State ^= m_State >> 17;
+		m_State ^= m_State << 5;
+		return PxReal(m_State & 0xffffff) / PxReal(0xffffff);
+	}
+
+	PxReal Range(PxReal minimum, PxReal maximum) { return minimum + (maximum - minimum) * Next(); }
+
+	PxVec3 InBounds(const PxBounds3& bounds)
+	{
+		return PxVec3(Range(bounds.minimum.x, bounds.maximum.x),
+			Range(bounds.minimum.y, bounds.maximum.y),
+			Range(bounds.minimum.z, bounds.maximum.z));
+	}
+
+private:
+	PxU32 m_State;
+};
+
+void CreateArena()
+{
+	PxRigidStatic* ground = PxCreatePlane(*gPhysics, PxPlane(0, 1, 0, 0), *gMaterial);
+	gScene->addActor(*ground);
+
+	const PxVec3 center = gWorldBounds.getCenter();
+	const PxVec3 extents = gWorldBounds.getExtents();
+	const PxReal thickness = 1.0f;
+
+	const PxTransform walls[4] =
+	{
+		PxTransform(PxVec3(gWorldBounds.minimum.x + thickness, center.y, center.z)),
+		PxTransform(PxVec3(gWorldBounds.maximum.x - thickness, center.y, center.z)),
+		PxTransform(PxVec3(center.x, center.y, gWorldBounds.minimum.z + thickness)),
+		PxTransform(PxVec3(center.x, center.y, gWorldBounds.maximum.z - thickness)),
+	};
+
+	for (PxU32 i = 0; i < 4; i++)
+	{
+		const PxBoxGeometry geometry = i < 2 ? PxBoxGeometry(thickness, extents.y, extents.z)
+			: PxBoxGeometry(extents.x, extents.y, thickness);
+
+		gScene->addActor(*PxCreateStatic(*gPhysics, walls[i], geometry, *gMaterial));
+	}
+}
+
+void CreateStaticField(PxU32 count, Random& random)
+{
+	PxShape* shape = gPhysics->createShape(PxBoxGeometry(1.0f, 1.0f, 1.0f), *gMaterial);
+
+	PxBounds3 bounds = gWorldBounds;
+	bounds.fattenFast(-10.0f);
+	bounds.minimum.y = 1.0f;
+	bounds.maximum.y = 30.0f;
+
+	for (PxU32 i = 0; i < count; i++)
+	{
+		PxRigidStatic* body = gPhysics->createRigidStatic(PxTransform(random.InBounds(bounds)));
+		body->attachShape(*shape);
+		gScene->addActor(*body);
+	}
+
+	shape->release();
+}
+
+void CreateDynamicCloud(PxU32 count, Random& random, PxReal minY, PxReal maxY, PxReal speed)
+{
+	PxShape* shape = gPhysics->createShape(PxSphereGeometry(0.5f), *gMaterial);
+
+	PxBounds3 bounds = gWorldBounds;
+	bounds.fattenFast(-10.0f);
+	bounds.minimum.y = minY;
+	bounds.maximum.y = maxY;
+
+	for (PxU32 i = 0; i < count; i++)
+	{
+		PxRigidDynamic* body = gPhysics->createRigidDynamic(PxTransform(random.InBounds(bounds)));
+		body->attachShape(*shape);
+		PxRigidBodyExt::updateMassAndInertia(*body, 1.0f);
+
+		if (speed > 0.0f)
+		{
+			PxVec3 direction(random.Range(-1.0f, 1.0f), random.Range(-0.1f, 0.3f), random.Range(-1.0f, 1.0f));
+			direction.normalizeSafe();
+			body->setLinearVelocity(direction * speed);
+			body->setLinearDamping(0.0f);
+		}
+
+		gScene->addActor(*body);
+	}
+
+	shape->release();
+}
+
+void CreateStack(const PxTransform& t, PxU32 size, PxReal halfExtent, PxShape* shape)
+{
+	for (PxU32 i = 0; i < size; i++)
+	{
+		for (PxU32 j = 0; j < size - i; j++)
+		{
+			PxTransform localTm(PxVec3(PxReal(j * 2) - PxReal(size - i), PxReal(i * 2 + 1), 0) * halfExtent);
+			PxRigidDynamic* body = gPhysics->createRigidDynamic(t.transform(localTm));
+			body->attachShape(*shape);
+			PxRigidBodyExt::updateMassAndInertia(*body, 10.0f);
+			gScene->addActor(*body);
+		}
+	}
+}
+
+void CreateClusteredStacks(PxU32 nbClusters, PxU32 stacksPerCluster, Random& random)
+{
+	const PxReal halfExtent = 0.5f;
+	PxShape* shape = gPhysics->createShape(PxBoxGeometry(halfExtent, halfExtent, halfExtent), *gMaterial);
+
+	PxBounds3 bounds = gWorldBounds;
+	bounds.fattenFast(-30.0f);
+
+	for (PxU32 i = 0; i < nbClusters; i++)
+	{
+		const PxVec3 center(random.Range(bounds.minimum.x, bounds.maximum.x), 0.0f,
+			random.Range(bounds.minimum.z, bounds.maximum.z));
+
+		for (PxU32 j = 0; j < stacksPerCluster; j++)
+		{
+			CreateStack(PxTransform(center + PxVec3(0.0f, 0.0f, PxReal(j) * 2.0f)), 8, halfExtent, shape);
+		}
+	}
+
+	shape->release();
+}
+
+void BuildWorkload(Workload workload)
+{
+	Random random(1234567u);
+
+	CreateArena();
+
+	switch (workload)
+	{
+	case eSTATIC_HEAVY:
+		CreateStaticField(20000, random);
+		CreateDynamicCloud(500, random, 40.0f, 90.0f, 0.0f);
+		break;
+	case eDYNAMIC_HEAVY:
+		CreateDynamicCloud(8000, random, 5.0f, 90.0f, 0.0f);
+		break;
+	case ePROJECTILES:
+		CreateStaticField(4000, random);
+		CreateDynamicCloud(1000, random, 2.0f, 30.0f, 150.0f);
+		break;
+	case eCLUSTERED_STACKS:
+		CreateClusteredStacks(10, 10, random);
+		break;
+	case eWORKLOAD_COUNT:
+		break;
+	}
+}
+
+BenchmarkResult RunBenchmark(Workload workload, PxBroadPhaseType::Enum broadPhaseType)
+{
+	PxSceneDesc sceneDesc(gPhysics->getTolerancesScale());
+	sceneDesc.gravity = PxVec3(0.0f, -9.81f, 0.0f);
+	sceneDesc.cpuDispatcher = gDispatcher;
+	sceneDesc.filterShader = PxDefaultSimulationFilterShader;
+	sceneDesc.broadPhaseType = broadPhaseType;
+	sceneDesc.broadPhaseCallback = &gOutOfBoundsHandler;
+	gScene = gPhysics->createScene(sceneDesc);
+
+	BuildWorkload(workload);
+
+	if (broadPhaseType == PxBroadPhaseType::eMBP)
+	{
+		gRegionManager.Init(*gScene, gWorldBounds);
+	}
+
+	for (PxU32 i = 0; i < gWarmUpFrames; i++)
+	{
+		gScene->simulate(1.0f / 60.0f);
+		gScene->fetchResults(true);
+		gOutOfBoundsHandler.Process(*gScene);
+	}
+
+	BenchmarkResult result = {};
+	PxU64 simulateTicks = 0;
+
+	gZoneTimer.Reset();
+
+	for (PxU32 i = 0; i < gMeasureFrames; i++)
+	{
+		const PxU64 start = SnippetUtils::getCurrentTimeCounterValue();
+		gScene->simulate(1.0f / 60.0f);
+		gScene->fetchResults(true);
+		simulateTicks += SnippetUtils::getCurrentTimeCounterValue() - start;
+
+		gOutOfBoundsHandler.Process(*gScene);
+
+		PxSimulationStatistics stats;
+		gScene->getSimulationStatistics(stats);
+
+		result.nbAdds += stats.getNbBroadPhaseAdds();
+		result.nbRemoves += stats.getNbBroadPhaseRemoves();
+		result.nbNewPairs += stats.nbNewPairs;
+		result.nbLostPairs += stats.nbLostPairs;
+		result.maxPairs = PxMax(result.maxPairs, stats.nbDiscreteContactPairsTotal);
+	}
+
+	result.hasAabbManagerZones = gZoneTimer.GetNbCalls(gAabbManagerZone) != 0;
+	result.hasBroadPhaseZones = gZoneTimer.GetNbCalls(gBroadPhaseCoreZone) != 0;
+	result.aabbManagerMs = gZoneTimer.GetMilliseconds(gAabbManagerZone) / PxReal(gMeasureFrames);
+	result.broadPhaseMs = gZoneTimer.GetMilliseconds(gBroadPhaseCoreZone) / PxReal(gMeasureFrames);
+	result.simulateMs = SnippetUtils::getElapsedTimeInMilliseconds(simulateTicks) / PxReal(gMeasureFrames);
+
+	gRegionManager.Release();
+	PX_RELEASE(gScene);
+
+	return result;
+}
+
+void PrintTable(const BenchmarkResult (&results)[eWORKLOAD_COUNT][gNbBroadPhaseTypes])
+{
+	printf("\n%-18s %-4s %10s %10s %10s %8s %8s %9s %9s %9s\n",
+		"workload", "bp", "aabb ms", "core ms", "step ms", "adds", "removes", "newPairs", "lostPairs", "maxPairs");
+
+	for (PxU32 i = 0; i < eWORKLOAD_COUNT; i++)
+	{
+		PxU32 best = 0;
+
+		for (PxU32 j = 0; j < gNbBroadPhaseTypes; j++)
+		{
+			const BenchmarkResult& r = results[i][j];
+
+			if (r.simulateMs < results[i][best].simulateMs)
+			{
+				best = j;
+			}
+
+			char aabbManager[16] = "n/a";
+			char core[16] = "n/a";
+
+			if (r.hasAabbManagerZones)
+			{
+				snprintf(aabbManager, sizeof(aabbManager), "%.3f", r.aabbManagerMs);
+			}
+
+			if (r.hasBroadPhaseZones)
+			{
+				snprintf(core, sizeof(core), "%.3f", r.broadPhaseMs);
+			}
+
+			printf("%-18s %-4s %10s %10s %10.3f %8u %8u %9u %9u %9u\n", gWorkloadNames[i], gBroadPhaseNames[j],
+				aabbManager, core, r.simulateMs, r.nbAdds, r.nbRemoves, r.nbNewPairs, r.nbLostPairs, r.maxPairs);
+		}
+
+		printf("%-18s -> fastest step: %s\n\n", gWorkloadNames[i], gBroadPhaseNames[best]);
+	}
+
+	printf("aabb ms: AABBManager zones, emitted by every broadphase type.\n");
+	printf("core ms: broadphase update zones, only SAP emits them (n/a for MBP and ABP).\n");
+	printf("both are zone time summed over all threads per frame, not wall time.\n");
+}
+
+void InitPhysics()
+{
+	gFoundation = PxCreateFoundation(PX_PHYSICS_VERSION, gAllocator, gErrorCallback);
+
+	// PVD   Ÿ̸Ӹ Ϸ Ѵ.
+	const char* aabbManagerZones[] =
+	{
+		"AABBManager::updateAABBsAndBP",
+		"AABBManager::finalizeUpdate",
+		"AABBManager::postBroadPhase",
+	};
+	const char* broadPhaseCoreZones[] =
+	{
+		"BroadPhase.SapUpdate",
+		"BroadPhase.SapPostUpdate",
+	};
+	gAabbManagerZone = gZoneTimer.AddZone(aabbManagerZones, 3);
+	gBroadPhaseCoreZone = gZoneTimer.AddZone(broadPhaseCoreZones, 2);
+	PxSetProfilerCallback(&gZoneTimer);
+
+	gPhysics = PxCreatePhysics(PX_PHYSICS_VERSION, *gFoundation, PxTolerancesScale(), true);
+
+	PxU32 numCores = SnippetUtils::getNbPhysicalCores();
+	gDispatcher = PxDefaultCpuDispatcherCreate(numCores == 0 ? 0 : numCores - 1);
+
+	gMaterial = gPhysics->createMaterial(0.5f, 0.5f, 0.6f);
+
+	for (PxU32 i = 0; i < OutOfBoundsHandler::MAX_TAGS; i++)
+	{
+		gOutOfBoundsHandler.SetPolicy(i, OutOfBoundsPolicy::eIGNORE);
+	}
+}
+
+void CleanupPhysics()
+{
+	gOutOfBoundsHandler.Release();
+	PX_RELEASE(gDispatcher);
+	PX_RELEASE(gPhysics);
+	PxSetProfilerCallback(NULL);
+	PX_RELEASE(gFoundation);
+
+	printf("SnippetBroadPhaseBenchmark done.\n");
+}
+
+int SnippetMain(int, const char* const*)
+{
+	InitPhysics();
+
+	static BenchmarkResult results[eWORKLOAD_COUNT][gNbBroadPhaseTypes];
+
+	for (PxU32 i = 0; i < eWORKLOAD_COUNT; i++)
+	{
+		for (PxU32 j = 0; j < gNbBroadPhaseTypes; j++)
+		{
+			printf("running %s with %s...\n", gWorkloadNames[i], gBroadPhaseNames[j]);
+			results[i][j] = RunBenchmark(Workload(i), gBroadPhaseTypes[j]);
+		}
+	}
+
+	PrintTable(results);
+
+	CleanupPhysics();
+
+	return 0;
+}
@@ -0,0 +1,235 @@
+/*
+	  Ÿ Ʈ .
+
+	ó   Ÿϸ  Ϳ PxPruningStructure  ̳ʸ Ϸ д.
+	Ŀ ( 忡 ī޶, ƴϸ  ׸ ̴ ) ֺ Ÿϸ
+	׶ 忡 о  ְ, ־ Ÿ .
+*/
+
+//https://gameworksdocs.nvidia.com/PhysX/4.1/documentation/physxguide/Manual/SceneQueries.html#pxpruningstructure
+//https://gameworksdocs.nvidia.com/PhysX/4.1/documentation/physxguide/Manual/Serialization.html
+
+#include <ctype.h>
+#include <vector>
+
+#include "PxPhysicsAPI.h"
+
+#include "SnippetUtils.h"
+#include "SnippetPrint.h"
+#include "SnippetPVD.h"
+
+#include "WorldStreamer.h"
+
+using namespace physx;
+
+PxDefaultAllocator		gAllocator;
+PxDefaultErrorCallback	gErrorCallback;
+
+PxFoundation* gFoundation = NULL;
+PxPhysics* gPhysics = NULL;
+
+PxDefaultCpuDispatcher* gDispatcher = NULL;
+PxScene* gScene = NULL;
+
+PxMaterial* gMaterial = NULL;
+
+PxPvd* gPvd = NULL;
+
+// Ÿϵ   . Ÿ Ͽ id  ȴ.
+PxCollection* gSharedCollection = NULL;
+const PxSerialObjectId gMaterialId = 1;
+
+WorldStreamer gWorldStreamer;
+PxVec3 gStreamingFocus(0.0f);
+
+// -gWorldTileRadius ~ gWorldTileRadius  Ÿ .
+const PxI32 gWorldTileRadius = 6;
+const PxU32 gBoxesPerTile = 80;
+
+PxU32 gFrame = 0;
+
+PxRigidDynamic* CreateDynamic(const PxTransform& t, const PxGeometry& geometry, const PxVec3& velocity = PxVec3(0))
+{
+	PxRigidDynamic* dynamic = PxCreateDynamic(*gPhysics, t, geometry, *gMaterial, 10.0f);
+	dynamic->setAngularDamping(0.5f);
+	dynamic->setLinearVelocity(velocity);
+	gScene->addActor(*dynamic);
+	return dynamic;
+}
+
+// Ÿ ǥ õ带 ؼ ׻    Ѵ.
+void CreateTileActors(PxI32 x, PxI32 z, std::vector<PxRigidActor*>& actors)
+{
+	const PxBounds3 bounds = gWorldStreamer.GetTileBounds(x, z);
+	PxU32 seed = PxU32(x * 73856093) ^ PxU32(z * 19349663) ^ 0x9e3779b9u;
+
+	auto random = [&seed]()
+	{
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+		return PxReal(seed & 0xffff) / PxReal(0xffff);
+	};
+
+	for (PxU32 i = 0; i < gBoxesPerTile; i++)
+	{
+		const PxVec3 halfExtents(1.0f + random() * 3.0f, 1.0f + random() * 8.0f, 1.0f + random() * 3.0f);
+		const PxVec3 position(bounds.minimum.x + random() * (bounds.maximum.x - bounds.minimum.x), halfExtents.y,
+			bounds.minimum.z + random() * (bounds.maximum.z - bounds.minimum.z));
+
+		actors.push_back(PxCreateStatic(*gPhysics, PxTransform(position), PxBoxGeometry(halfExtents), *gMaterial));
+	}
+}
+
+void BakeWorld()
+{
+	const PxU64 start = SnippetUtils::getCurrentTimeCounterValue();
+	PxU32 nbBaked = 0;
+
+	std::vector<PxRigidActor*> actors;
+
+	for (PxI32 z = -gWorldTileRadius; z <= gWorldTileRadius; z++)
+	{
+		for (PxI32 x = -gWorldTileRadius; x <= gWorldTileRadius; x++)
+		{
+			if (gWorldStreamer.HasTile(x, z))
+			{
+				continue;
+			}
+
+			actors.clear();
+			CreateTileActors(x, z, actors);
+
+			if (gWorldStreamer.BakeTile(x, z, actors))
+			{
+				nbBaked++;
+			}
+		}
+	}
+
+	if (nbBaked)
+	{
+		printf("baked %u tiles : %.1fms\n", nbBaked,
+			SnippetUtils::getElapsedTimeInMilliseconds(SnippetUtils::getCurrentTimeCounterValue() - start));
+	}
+}
+
+void PrintStreamingStats()
+{
+	printf("frame %4u : tiles in scene %u, pending %u, inserted %u, removed %u, update %.3fms (max %.3fms)\n",
+		gFrame, gWorldStreamer.GetNbTilesInScene(), gWorldStreamer.GetNbPendingTiles(),
+		gWorldStreamer.GetNbInserted(), gWorldStreamer.GetNbRemoved(),
+		gWorldStreamer.GetLastUpdateMilliseconds(), gWorldStreamer.GetMaxUpdateMilliseconds());
+}
+
+void InitPhysics(bool)
+{
+	gFoundation = PxCreateFoundation(PX_PHYSICS_VERSION, gAllocator, gErrorCallback);
+
+	gPvd = PxCreatePvd(*gFoundation);
+	PxPvdTransport* pvdTransport = PxDefaultPvdSocketTransportCreate(PVD_HOST, 5425, 10);
+	gPvd->connect(*pvdTransport, PxPvdInstrumentationFlag::eALL);
+
+	gPhysics = PxCreatePhysics(PX_PHYSICS_VERSION, *gFoundation, PxTolerancesScale(), true, gPvd);
+
+	PxSceneDesc sceneDesc(gPhysics->getTolerancesScale());
+	sceneDesc.gravity = PxVec3(0, -9.81f, 0);
+
+	PxU32 numCores = SnippetUtils::getNbPhysicalCores();
+	gDispatcher = PxDefaultCpuDispatcherCreate(numCores == 0 ? 0 : numCores - 1);
+	sceneDesc.cpuDispatcher = gDispatcher;
+	sceneDesc.filterShader = PxDefaultSimulationFilterShader;
+
+	gScene = gPhysics->createScene(sceneDesc);
+
+	PxPvdSceneClient* pvdClient = gScene->getScenePvdClient();
+	if (pvdClient)
+	{
+		pvdClient->setScenePvdFlag(PxPvdSceneFlag::eTRANSMIT_CONSTRAINTS, true);
+		pvdClient->setScenePvdFlag(PxPvdSceneFlag::eTRANSMIT_CONTACTS, true);
+		pvdClient->setScenePvdFlag(PxPvdSceneFlag::eTRANSMIT_SCENEQUERIES, true);
+	}
+
+	gMaterial = gPhysics->createMaterial(0.5f, 0.5f, 0.6f);
+
+	PxRigidStatic* ground = PxCreatePlane(*gPhysics, PxPlane(0, 1, 0, 0), *gMaterial);
+	gScene->addActor(*ground);
+
+	gSharedCollection = PxCreateCollection();
+	gSharedCollection->add(*gMaterial, gMaterialId);
+
+	WorldStreamer::Desc streamerDesc;
+	streamerDesc.tileSize = 100.0f;
+	streamerDesc.loadRadius = 2;
+	streamerDesc.unloadRadius = 3;
+	gWorldStreamer.Init(*gPhysics, *gScene, gSharedCollection, streamerDesc);
+
+	BakeWorld();
+}
+
+void StepPhysics(bool interactive)
+{
+	gScene->simulate(1 / 60.0f);
+	gScene->fetchResults(true);
+
+	//  尡 ƴϸ   400   δ.
+	if (!interactive)
+	{
+		const PxReal angle = PxReal(gFrame) * 0.01f;
+		gStreamingFocus = PxVec3(PxCos(angle), 0.0f, PxSin(angle)) * 400.0f;
+	}
+
+	gWorldStreamer.Update(gStreamingFocus);
+
+	gFrame++;
+}
+
+void CleanupPhysics(bool)
+{
+	gWorldStreamer.Release();
+	PX_RELEASE(gSharedCollection);
+	PX_RELEASE(gScene);
+	PX_RELEASE(gDispatcher);
+	PX_RELEASE(gPhysics);
+	if (gPvd)
+	{
+		PxPvdTransport* transport = gPvd->getTransport();
+		gPvd->release();	gPvd = NULL;
+		PX_RELEASE(transport);
+	}
+	PX_RELEASE(gFoundation);
+
+	printf("SnippetWorldStreaming done.\n");
+}
+
+void KeyPress(unsigned char key, const PxTransform& camera)
+{
+	switch (toupper(key))
+	{
+	case ' ':	CreateDynamic(camera, PxSphereGeometry(3.0f), camera.rotate(PxVec3(0, 0, -1)) * 200);	break;
+	}
+}
+
+int SnippetMain(int, const char* const*)
+{
+#ifdef RENDER_SNIPPET
+	extern void RenderLoop();
+	RenderLoop();
+#else
+	static const PxU32 frameCount = 600;
+	InitPhysics(false);
+	for (PxU32 i = 0; i < frameCount; i++)
+	{
+		StepPhysics(false);
+
+		if (gFrame % 100 == 0)
+		{
+			PrintStreamingStats();
+		}
+	}
+	PrintStreamingStats();
+	CleanupPhysics(false);
+#endif
+
+	return 0;
+}
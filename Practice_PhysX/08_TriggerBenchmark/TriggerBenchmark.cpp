@@ -0,0 +1,262 @@
+/*
+	Ʈ 10000 TriggerSystem      Ѵ.
+
+	- events		: Ʈ   ְ onTrigger ̺Ʈ 
+	- polled / n	:   ʰ n Ӹ   
+
+	̴  Ʈ  ̸ ƴٴϰ,     հ    纻.
+	  ֿܼ Ѵ.
+*/
+
+#include "PxPhysicsAPI.h"
+
+#include "SnippetPrint.h"
+#include "SnippetUtils.h"
+
+#include "TriggerSystem.h"
+
+using namespace physx;
+
+PxDefaultAllocator		gAllocator;
+PxDefaultErrorCallback	gErrorCallback;
+
+PxFoundation* gFoundation = NULL;
+PxPhysics* gPhysics = NULL;
+
+PxDefaultCpuDispatcher* gDispatcher = NULL;
+PxScene* gScene = NULL;
+
+PxMaterial* gMaterial = NULL;
+
+TriggerSystem gTriggerSystem;
+
+const PxU32 gTriggerGrid = 100;		// 100 x 100 = 10000
+const PxReal gTriggerSpacing = 4.0f;
+const PxU32 gNbBodies = 2000;
+
+const PxU32 gWarmUpFrames = 30;
+const PxU32 gMeasureFrames = 200;
+
+const PxBounds3 gWorldBounds(PxVec3(-210.0f, 0.0f, -210.0f), PxVec3(210.0f, 20.0f, 210.0f));
+
+struct BenchmarkConfig
+{
+	const char*	name;
+	TriggerMode	mode;
+	PxU32		pollInterval;
+};
+
+const BenchmarkConfig gConfigs[] =
+{
+	{ "events",		TriggerMode::eEVENTS,	1 },
+	{ "polled / 1",	TriggerMode::ePOLLED,	1 },
+	{ "polled / 4",	TriggerMode::ePOLLED,	4 },
+};
+
+const PxU32 gNbConfigs = sizeof(gConfigs) / sizeof(gConfigs[0]);
+
+struct BenchmarkResult
+{
+	PxReal	stepMs;			// Ӵ  (simulate + fetchResults)
+	PxReal	updateMs;		// Ӵ  (TriggerSystem::Update)
+	PxU32	nbEvents;		//   հ
+	PxU32	nbOccupants;	//     հ
+};
+
+class TriggerCallback : public PxSimulationEventCallback
+{
+	virtual void onConstraintBreak(PxConstraintInfo*, PxU32) override {}
+	virtual void onWake(PxActor**, PxU32) override {}
+	virtual void onSleep(PxActor**, PxU32) override {}
+	virtual void onContact(const PxContactPairHeader&, const PxContactPair*, PxU32) override {}
+	virtual void onAdvance(const PxRigidBody* const*, const PxTransform*, const PxU32) override {}
+	virtual void onTrigger(PxTriggerPair* pairs, PxU32 count) override
+	{
+		gTriggerSystem.OnTrigger(pairs, count);
+	}
+} gTriggerCallback;
+
+// ۾  . ׻    .
+class Random
+{
+public:
+	explicit Random(PxU32 seed) : m_State(seed) {}
+
+	PxReal Next()
+	{
+		m_State ^= m_State << 13;
+		m_State ^= m_State >> 17;
+		m_State ^= m_State << 5;
+		return PxReal(m_State & 0xffffff) / PxReal(0xffffff);
+	}
+
+	PxReal Range(PxReal minimum, PxReal maximum) { return minimum + (maximum - minimum) * Next(); }
+
+private:
+	PxU32 m_State;
+};
+
+void CreateArena()
+{
+	PxRigidStatic* ground = PxCreatePlane(*gPhysics, PxPlane(0, 1, 0, 0), *gMaterial);
+	gScene->addActor(*ground);
+
+	const PxVec3 center = gWorldBounds.getCenter();
+	const PxVec3 extents = gWorldBounds.getExtents();
+	const PxReal thickness = 1.0f;
+
+	const PxTransform walls[4] =
+	{
+		PxTransform(PxVec3(gWorldBounds.minimum.x, center.y, center.z)),
+		PxTransform(PxVec3(gWorldBounds.maximum.x, center.y, center.z)),
+		PxTransform(PxVec3(center.x, center.y, gWorldBounds.minimum.z)),
+		PxTransform(PxVec3(center.x, center.y, gWorldBounds.maximum.z)),
+	};
+
+	for (PxU32 i = 0; i < 4; i++)
+	{
+		const PxBoxGeometry geometry = i < 2 ? PxBoxGeometry(thickness, extents.y, extents.z)
+			: PxBoxGeometry(extents.x, extents.y, thickness);
+
+		gScene->addActor(*PxCreateStatic(*gPhysics, walls[i], geometry, *gMaterial));
+	}
+}
+
+void CreateTriggers(TriggerMode mode)
+{
+	const PxBoxGeometry geometry(1.5f, 2.0f, 1.5f);
+	const PxReal origin = -0.5f * gTriggerSpacing * PxReal(gTriggerGrid - 1);
+
+	for (PxU32 i = 0; i < gTriggerGrid; i++)
+	{
+		for (PxU32 j = 0; j < gTriggerGrid; j++)
+		{
+			const PxVec3 position(origin + PxReal(i) * gTriggerSpacing, 2.0f, origin + PxReal(j) * gTriggerSpacing);
+			gTriggerSystem.AddTrigger(geometry, PxTransform(position), mode);
+		}
+	}
+}
+
+void CreateBodies(Random& random)
+{
+	PxShape* shape = gPhysics->createShape(PxSphereGeometry(0.5f), *gMaterial);
+
+	for (PxU32 i = 0; i < gNbBodies; i++)
+	{
+		const PxVec3 position(random.Range(-190.0f, 190.0f), random.Range(1.0f, 3.0f), random.Range(-190.0f, 190.0f));
+		PxVec3 direction(random.Range(-1.0f, 1.0f), 0.0f, random.Range(-1.0f, 1.0f));
+		direction.normalizeSafe();
+
+		PxRigidDynamic* body = gPhysics->createRigidDynamic(PxTransform(position));
+		body->attachShape(*shape);
+		PxRigidBodyExt::updateMassAndInertia(*body, 1.0f);
+		body->setLinearVelocity(direction * 10.0f);
+		body->setLinearDamping(0.0f);
+		gScene->addActor(*body);
+	}
+
+	shape->release();
+}
+
+BenchmarkResult RunBenchmark(const BenchmarkConfig& config)
+{
+	PxSceneDesc sceneDesc(gPhysics->getTolerancesScale());
+	sceneDesc.gravity = PxVec3(0.0f);
+	sceneDesc.cpuDispatcher = gDispatcher;
+	sceneDesc.filterShader = PxDefaultSimulationFilterShader;
+	sceneDesc.simulationEventCallback = &gTriggerCallback;
+	gScene = gPhysics->createScene(sceneDesc);
+
+	Random random(1234567u);
+	CreateArena();
+	CreateBodies(random);
+
+	gTriggerSystem.Init(*gPhysics, *gScene);
+	gTriggerSystem.SetPollInterval(config.pollInterval);
+	CreateTriggers(config.mode);
+
+	for (PxU32 i = 0; i < gWarmUpFrames; i++)
+	{
+		gScene->simulate(1.0f / 60.0f);
+		gScene->fetchResults(true);
+		gTriggerSystem.Update();
+	}
+
+	BenchmarkResult result = {};
+	PxU64 stepTicks = 0;
+	PxU64 updateTicks = 0;
+
+	for (PxU32 i = 0; i < gMeasureFrames; i++)
+	{
+		PxU64 start = SnippetUtils::getCurrentTimeCounterValue();
+		gScene->simulate(1.0f / 60.0f);
+		gScene->fetchResults(true);
+		stepTicks += SnippetUtils::getCurrentTimeCounterValue() - start;
+
+		start = SnippetUtils::getCurrentTimeCounterValue();
+		gTriggerSystem.Update();
+		updateTicks += SnippetUtils::getCurrentTimeCounterValue() - start;
+
+		result.nbEvents += gTriggerSystem.GetNbEvents();
+	}
+
+	for (PxU32 i = 0; i < gTriggerSystem.GetNbTriggers(); i++)
+	{
+		result.nbOccupants += gTriggerSystem.GetNbOccupants(i);
+	}
+
+	result.stepMs = SnippetUtils::getElapsedTimeInMilliseconds(stepTicks) / PxReal(gMeasureFrames);
+	result.updateMs = SnippetUtils::getElapsedTimeInMilliseconds(updateTicks) / PxReal(gMeasureFrames);
+
+	gTriggerSystem.Release();
+	PX_RELEASE(gScene);
+
+	return result;
+}
+
+void InitPhysics()
+{
+	gFoundation = PxCreateFoundation(PX_PHYSICS_VERSION, gAllocator, gErrorCallback);
+	gPhysics = PxCreatePhysics(PX_PHYSICS_VERSION, *gFoundation, PxTolerancesScale(), true);
+
+	PxU32 numCores = SnippetUtils::getNbPhysicalCores();
+	gDispatcher = PxDefaultCpuDispatcherCreate(numCores == 0 ? 0 : numCores - 1);
+
+	gMaterial = gPhysics->createMaterial(0.0f, 0.0f, 1.0f);
+}
+
+void CleanupPhysics()
+{
+	PX_RELEASE(gDispatcher);
+	PX_RELEASE(gPhysics);
+	PX_RELEASE(gFoundation);
+
+	printf("SnippetTriggerBenchmark done.\n");
+}
+
+int SnippetMain(int, const char* const*)
+{
+	InitPhysics();
+
+	BenchmarkResult results[gNbConfigs];
+
+	for (PxU32 i = 0; i < gNbConfigs; i++)
+	{
+		printf("running %s...\n", gConfigs[i].name);
+		results[i] = RunBenchmark(gConfigs[i]);
+	}
+
+	printf("\n%u triggers, %u bodies, %u frames\n", gTriggerGrid * gTriggerGrid, gNbBodies, gMeasureFrames);
+	printf("%-12s %10s %10s %10s %10s %10s\n", "mode", "step ms", "update ms", "total ms", "events", "occupants");
+
+	for (PxU32 i = 0; i < gNbConfigs; i++)
+	{
+		const BenchmarkResult& r = results[i];
+		printf("%-12s %10.3f %10.3f %10.3f %10u %10u\n", gConfigs[i].name,
+			r.stepMs, r.updateMs, r.stepMs + r.updateMs, r.nbEvents, r.nbOccupants);
+	}
+
+	CleanupPhysics();
+
+	return 0;
+}
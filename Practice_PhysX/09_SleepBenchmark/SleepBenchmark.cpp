@@ -0,0 +1,259 @@
+/*
+	̳ ٵ 10  κ  , ִ ٵ      .
+
+	- poll		:    ͸  ޾ƿ isSleeping() ´.
+	- tracked	: SleepTracker  onWake / onSleep  ϴ ִ ո .
+
+	ٵ ٴ  ߷  ݹ ,  ߿      ƨ .
+	  ã ִ ٵ  ٸ mismatch  .
+	 ֿܼ Ѵ.
+*/
+
+#include <vector>
+
+#include "PxPhysicsAPI.h"
+
+#include "SnippetPrint.h"
+#include "SnippetUtils.h"
+
+#include "SleepTracker.h"
+
+using namespace physx;
+
+PxDefaultAllocator		gAllocator;
+PxDefaultErrorCallback	gErrorCallback;
+
+PxFoundation* gFoundation = NULL;
+PxPhysics* gPhysics = NULL;
+
+PxDefaultCpuDispatcher* gDispatcher = NULL;
+PxScene* gScene = NULL;
+
+PxMaterial* gMaterial = NULL;
+
+SleepTracker gSleepTracker;
+std::vector<PxRigidDynamic*> gBodies;
+
+const PxU32 gGridX = 400;
+const PxU32 gGridZ = 250;		// 400 x 250 = 100000
+const PxReal gSpacing = 2.0f;
+
+const PxU32 gMaxSettleFrames = 600;
+const PxReal gSettledRatio = 0.05f;	// ִ ٵ   Ʒ   Ѵ.
+const PxU32 gMeasureFrames = 300;
+const PxU32 gKicksPerFrame = 50;
+
+PxU64 gEventTicks = 0;
+
+class SleepCallback : public PxSimulationEventCallback
+{
+	virtual void onConstraintBreak(PxConstraintInfo*, PxU32) override {}
+	virtual void onWake(PxActor** actors, PxU32 count) override
+	{
+		const PxU64 start = SnippetUtils::getCurrentTimeCounterValue();
+		gSleepTracker.OnWake(actors, count);
+		gEventTicks += SnippetUtils::getCurrentTimeCounterValue() - start;
+	}
+	virtual void onSleep(PxActor** actors, PxU32 count) override
+	{
+		const PxU64 start = SnippetUtils::getCurrentTimeCounterValue();
+		gSleepTracker.OnSleep(actors, count);
+		gEventTicks += SnippetUtils::getCurrentTimeCounterValue() - start;
+	}
+	virtual void onContact(const PxContactPairHeader&, const PxContactPair*, PxU32) override {}
+	virtual void onTrigger(PxTriggerPair*, PxU32) override {}
+	virtual void onAdvance(const PxRigidBody* const*, const PxTransform*, const PxU32) override {}
+} gSleepCallback;
+
+// ۾  . ׻   .
+class Random
+{
+public:
+	explicit Random(PxU32 seed) : m_State(seed) {}
+
+	PxU32 NextU32()
+	{
+		m_State ^= m_State << 13;
+		m_State ^= m_State >> 17;
+		m_State ^= m_State << 5;
+		return m_State;
+	}
+
+private:
+	PxU32 m_State;
+};
+
+void CreateBodies()
+{
+	gScene->addActor(*PxCreatePlane(*gPhysics, PxPlane(0, 1, 0, 0), *gMaterial));
+
+	PxShape* shape = gPhysics->createShape(PxBoxGeometry(0.5f, 0.5f, 0.5f), *gMaterial);
+	const PxReal originX = -0.5f * gSpacing * PxReal(gGridX - 1);
+	const PxReal originZ = -0.5f * gSpacing * PxReal(gGridZ - 1);
+
+	gBodies.reserve(gGridX * gGridZ);
+
+	for (PxU32 i = 0; i < gGridX; i++)
+	{
+		for (PxU32 j = 0; j < gGridZ; j++)
+		{
+			const PxVec3 position(originX + PxReal(i) * gSpacing, 0.6f, originZ + PxReal(j) * gSpacing);
+
+			PxRigidDynamic* body = gPhysics->createRigidDynamic(PxTransform(position));
+			body->attachShape(*shape);
+			PxRigidBodyExt::updateMassAndInertia(*body, 1.0f);
+			gScene->addActor(*body);
+
+			gSleepTracker.Add(*body);
+			gBodies.push_back(body);
+		}
+	}
+
+	shape->release();
+}
+
+void Step()
+{
+	gScene->simulate(1.0f / 60.0f);
+	gScene->fetchResults(true);
+}
+
+// ִ ٵ ġ д    ۾( ĳ,  ) .
+PxU32 IteratePolled(std::vector<PxActor*>& actors, PxVec3& checksum)
+{
+	const PxU32 nbActors = gScene->getActors(PxActorTypeFlag::eRIGID_DYNAMIC, actors.data(), PxU32(actors.size()));
+	PxU32 nbAwake = 0;
+
+	for (PxU32 i = 0; i < nbActors; i++)
+	{
+		PxRigidDynamic* body = static_cast<PxRigidDynamic*>(actors[i]);
+
+		if (!body->isSleeping())
+		{
+			checksum += body->getGlobalPose().p;
+			nbAwake++;
+		}
+	}
+
+	return nbAwake;
+}
+
+PxU32 IterateTracked(PxVec3& checksum)
+{
+	PxRigidActor* const* awake = gSleepTracker.GetAwake();
+	const PxU32 nbAwake = gSleepTracker.GetNbAwake();
+
+	for (PxU32 i = 0; i < nbAwake; i++)
+	{
+		checksum += awake[i]->getGlobalPose().p;
+	}
+
+	return nbAwake;
+}
+
+void InitPhysics()
+{
+	gFoundation = PxCreateFoundation(PX_PHYSICS_VERSION, gAllocator, gErrorCallback);
+	gPhysics = PxCreatePhysics(PX_PHYSICS_VERSION, *gFoundation, PxTolerancesScale(), true);
+
+	PxU32 numCores = SnippetUtils::getNbPhysicalCores();
+	gDispatcher = PxDefaultCpuDispatcherCreate(numCores == 0 ? 0 : numCores - 1);
+
+	gMaterial = gPhysics->createMaterial(0.5f, 0.5f, 0.1f);
+
+	PxSceneDesc sceneDesc(gPhysics->getTolerancesScale());
+	sceneDesc.gravity = PxVec3(0.0f, -9.81f, 0.0f);
+	sceneDesc.cpuDispatcher = gDispatcher;
+	sceneDesc.filterShader = PxDefaultSimulationFilterShader;
+	sceneDesc.simulationEventCallback = &gSleepCallback;
+	gScene = gPhysics->createScene(sceneDesc);
+
+	CreateBodies();
+}
+
+void CleanupPhysics()
+{
+	gSleepTracker.Clear();
+	gBodies.clear();
+
+	PX_RELEASE(gScene);
+	PX_RELEASE(gDispatcher);
+	PX_RELEASE(gPhysics);
+	PX_RELEASE(gFoundation);
+
+	printf("SnippetSleepBenchmark done.\n");
+}
+
+int SnippetMain(int, const char* const*)
+{
+	InitPhysics();
+
+	const PxU32 nbBodies = PxU32(gBodies.size());
+	PxU32 settleFrames = 0;
+
+	printf("settling %u bodies...\n", nbBodies);
+
+	while (settleFrames < gMaxSettleFrames && gSleepTracker.GetNbAwake() > PxU32(gSettledRatio * PxReal(nbBodies)))
+	{
+		Step();
+		settleFrames++;
+	}
+
+	printf("settled in %u frames, %u awake\n", settleFrames, gSleepTracker.GetNbAwake());
+
+	Random random(1234567u);
+	std::vector<PxActor*> actors(nbBodies);
+	PxVec3 pollChecksum(0.0f);
+	PxVec3 trackedChecksum(0.0f);
+	PxU64 stepTicks = 0;
+	PxU64 pollTicks = 0;
+	PxU64 trackedTicks = 0;
+	PxU64 nbAwakeSum = 0;
+	PxU32 nbMismatches = 0;
+
+	gEventTicks = 0;
+	gSleepTracker.ResetCounters();
+
+	for (PxU32 frame = 0; frame < gMeasureFrames; frame++)
+	{
+		//   ƨ ÷ .  ߸ ٽ .
+		for (PxU32 i = 0; i < gKicksPerFrame; i++)
+		{
+			gBodies[random.NextU32() % nbBodies]->setLinearVelocity(PxVec3(0.0f, 4.0f, 0.0f));
+		}
+
+		PxU64 start = SnippetUtils::getCurrentTimeCounterValue();
+		Step();
+		stepTicks += SnippetUtils::getCurrentTimeCounterValue() - start;
+
+		start = SnippetUtils::getCurrentTimeCounterValue();
+		const PxU32 nbPolled = IteratePolled(actors, pollChecksum);
+		pollTicks += SnippetUtils::getCurrentTimeCounterValue() - start;
+
+		start = SnippetUtils::getCurrentTimeCounterValue();
+		const PxU32 nbTracked = IterateTracked(trackedChecksum);
+		trackedTicks += SnippetUtils::getCurrentTimeCounterValue() - start;
+
+		nbAwakeSum += nbTracked;
+		nbMismatches += nbPolled != nbTracked ? 1 : 0;
+	}
+
+	const PxReal frames = PxReal(gMeasureFrames);
+
+	printf("\n%u bodies, %u frames, %u kicks per frame\n", nbBodies, gMeasureFrames, gKicksPerFrame);
+	printf("avg awake     : %.1f\n", PxReal(nbAwakeSum) / frames);
+	printf("wakes / sleeps: %u / %u\n", gSleepTracker.GetNbWakes(), gSleepTracker.GetNbSleeps());
+	printf("mismatches    : %u\n", nbMismatches);
+	printf("%-10s %10s\n", "work", "ms/frame");
+	printf("%-10s %10.3f\n", "step", SnippetUtils::getElapsedTimeInMilliseconds(stepTicks) / frames);
+	printf("%-10s %10.3f\n", "poll", SnippetUtils::getElapsedTimeInMilliseconds(pollTicks) / frames);
+	printf("%-10s %10.3f\n", "tracked", SnippetUtils::getElapsedTimeInMilliseconds(trackedTicks) / frames);
+	printf("%-10s %10.3f\n", "events", SnippetUtils::getElapsedTimeInMilliseconds(gEventTicks) / frames);
+
+	//    ٵ о Ȯο .
+	printf("checksum      : %.1f / %.1f\n", pollChecksum.magnitude(), trackedChecksum.magnitude());
+
+	CleanupPhysics();
+
+	return 0;
+}
@@ -0,0 +1,314 @@
+/*
+	 η   ϴ   ֹ  ã´.
+
+	- chain		:      Ʈ ü 30 ũ.  ̿ ũ Ʈ ڸ  ִ Ÿ.
+	- stack		:  16 ¥ ž 4 .  İ ̿ ó ڸ  и Ÿ  ū .
+	- pulley	: ԰ ٸ  ڸ Ŵ  8 ( 1, 2).    ̺ þ .
+
+	SolverTuner  PGS / TGS,  , ġ / ӵ ݺ Ƚ ո    .
+	ֹ /   ġ ϴ   ݺ Ƚ ϰ,  η õ   Ѵ.
+	 ֿܼ Ѵ.
+*/
+
+#include <vector>
+
+#include "PxPhysicsAPI.h"
+
+#include "SnippetPrint.h"
+#include "SnippetUtils.h"
+
+#include "SolverTuner.h"
+#include "../04_CustomJoint/PulleyJoint.h"
+
+// 1̸      Ѵ.
+#define PRINT_ALL_RESULTS 0
+
+using namespace physx;
+
+PxDefaultAllocator		gAllocator;
+PxDefaultErrorCallback	gErrorCallback;
+
+PxFoundation* gFoundation = NULL;
+PxPhysics* gPhysics = NULL;
+
+PxDefaultCpuDispatcher* gDispatcher = NULL;
+
+PxMaterial* gMaterial = NULL;
+
+class ChainScenario : public SolverTuningScenario
+{
+public:
+	virtual const char*	GetName() const override { return "chain"; }
+	virtual const char*	GetErrorName() const override { return "joint gap"; }
+	virtual PxReal		GetTolerance() const override { return 0.01f * SEPARATION; }
+	virtual bool		UsesContacts() const override { return false; }
+
+	virtual void Build(PxPhysics& physics, PxScene& scene, PxMaterial& material) override
+	{
+		const PxVec3 offset(SEPARATION / 2, 0, 0);
+		const PxBoxGeometry barGeometry(SEPARATION / 2, 0.5f, 0.5f);
+		PxTransform localTm(offset);
+		PxRigidDynamic* prev = nullptr;
+
+		for (PxU32 i = 0; i < LENGTH; i++)
+		{
+			PxRigidDynamic* link = PxCreateDynamic(physics, m_Anchor * localTm, barGeometry, material, 1.0f);
+			PxSphericalJoint* joint = PxSphericalJointCreate(physics, prev, prev ? PxTransform(offset) : m_Anchor, link, PxTransform(-offset));
+			joint->setLimitCone(PxJointLimitCone(PxPi / 4, PxPi / 4, 0.05f));
+			joint->setSphericalJointFlag(PxSphericalJointFlag::eLIMIT_ENABLED, true);
+
+			scene.addActor(*link);
+			m_Links.push_back(link);
+			prev = link;
+			localTm.p.x += SEPARATION;
+		}
+	}
+
+	virtual PxReal MeasureError() const override
+	{
+		const PxVec3 offset(SEPARATION / 2, 0, 0);
+		PxVec3 prevJoint = m_Anchor.p;
+		PxReal maxGap = 0.0f;
+
+		for (PxRigidDynamic* link : m_Links)
+		{
+			const PxTransform pose = link->getGlobalPose();
+			maxGap = PxMax(maxGap, (pose.transform(-offset) - prevJoint).magnitude());
+			prevJoint = pose.transform(offset);
+		}
+
+		return maxGap;
+	}
+
+	virtual void Clear() override { m_Links.clear(); }
+
+private:
+	static const PxU32 LENGTH = 30;
+	static constexpr PxReal SEPARATION = 4.0f;
+
+	const PxTransform m_Anchor = PxTransform(PxVec3(0.0f, 50.0f, 0.0f));
+	std::vector<PxRigidDynamic*> m_Links;
+};
+
+class StackScenario : public SolverTuningScenario
+{
+public:
+	virtual const char*	GetName() const override { return "stack"; }
+	virtual const char*	GetErrorName() const override { return "pen / drift"; }
+	virtual PxReal		GetTolerance() const override { return 0.02f; }
+
+	virtual void Build(PxPhysics& physics, PxScene& scene, PxMaterial& material) override
+	{
+		scene.addActor(*PxCreatePlane(physics, PxPlane(0, 1, 0, 0), material));
+
+		PxShape* shape = physics.createShape(PxBoxGeometry(HALF_EXTENT, HALF_EXTENT, HALF_EXTENT), material);
+
+		for (PxU32 i = 0; i < NB_TOWERS; i++)
+		{
+			for (PxU32 j = 0; j < HEIGHT; j++)
+			{
+				const PxVec3 position(PxReal(i) * 4.0f, HALF_EXTENT * PxReal(2 * j + 1), 0.0f);
+
+				PxRigidDynamic* box = physics.createRigidDynamic(PxTransform(position));
+				box->attachShape(*shape);
+				PxRigidBodyExt::updateMassAndInertia(*box, 1.0f);
+				scene.addActor(*box);
+
+				m_Boxes.push_back(box);
+				m_Start.push_back(position);
+			}
+		}
+
+		shape->release();
+	}
+
+	virtual PxReal MeasureError() const override
+	{
+		PxReal error = 0.0f;
+
+		for (PxU32 i = 0; i < NB_TOWERS; i++)
+		{
+			PxReal below = 0.0f;	// ٴ 
+
+			for (PxU32 j = 0; j < HEIGHT; j++)
+			{
+				const PxU32 index = i * HEIGHT + j;
+				const PxVec3 p = m_Boxes[index]->getGlobalPose().p;
+
+				// Ʒ  麸 󸶳 Դ.
+				const PxReal penetration = below - (p.y - HALF_EXTENT);
+				const PxReal drift = PxVec3(p.x - m_Start[index].x, 0.0f, p.z - m_Start[index].z).magnitude();
+
+				error = PxMax(error, PxMax(penetration, drift));
+				below = p.y + HALF_EXTENT;
+			}
+		}
+
+		return error;
+	}
+
+	virtual void Clear() override { m_Boxes.clear(); m_Start.clear(); }
+
+private:
+	static const PxU32 NB_TOWERS = 4;
+	static const PxU32 HEIGHT = 16;
+	static constexpr PxReal HALF_EXTENT = 0.5f;
+
+	std::vector<PxRigidDynamic*>	m_Boxes;
+	std::vector<PxVec3>				m_Start;
+};
+
+class PulleyScenario : public SolverTuningScenario
+{
+public:
+	virtual const char*	GetName() const override { return "pulley"; }
+	virtual const char*	GetErrorName() const override { return "stretch"; }
+	virtual PxReal		GetTolerance() const override { return 0.05f; }
+
+	virtual void Build(PxPhysics& physics, PxScene& scene, PxMaterial& material) override
+	{
+		scene.addActor(*PxCreatePlane(physics, PxPlane(0, 1, 0, 0), material));
+
+		const PxBoxGeometry boxGeom(1.0f, 1.0f, 1.0f);
+		const PxTransform localFrame(PxVec3(0.0f, 1.0f, 0.0f));
+
+		for (PxU32 i = 0; i < NB_PULLEYS; i++)
+		{
+			const PxReal z = PxReal(i) * 6.0f;
+			const PxReal ratio = (i & 1) ? 2.0f : 1.0f;
+
+			PxRigidDynamic* box0 = PxCreateDynamic(physics, PxTransform(PxVec3(5.0f, 8.0f, z)), boxGeom, material, 2.0f);
+			PxRigidDynamic* box1 = PxCreateDynamic(physics, PxTransform(PxVec3(0.0f, 8.0f, z)), boxGeom, material, 1.0f);
+
+			PulleyJoint* joint = new PulleyJoint(physics, *box0, localFrame, PxVec3(5.0f, 20.0f, z), *box1, localFrame, PxVec3(0.0f, 20.0f, z));
+			joint->SetRatio(ratio);
+
+			// ó ϰ. ſ box0  ٴڱ .
+			joint->SetDistance(11.0f + 11.0f * ratio);
+
+			scene.addActor(*box0);
+			scene.addActor(*box1);
+			m_Joints.push_back(joint);
+		}
+	}
+
+	virtual PxReal MeasureError() const override
+	{
+		PxReal error = 0.0f;
+
+		for (PulleyJoint* joint : m_Joints)
+		{
+			const PxVec3 joint0 = (joint->GetBody(0)->getGlobalPose() * joint->GetLocalFrame(0)).p;
+			const PxVec3 joint1 = (joint->GetBody(1)->getGlobalPose() * joint->GetLocalFrame(1)).p;
+			const PxReal length = (joint->GetAttachment0() - joint0).magnitude() + (joint->GetAttachment1() - joint1).magnitude() * joint->GetRatio();
+
+			//  þ  ȴ.
+			error = PxMax(error, length - joint->GetDistance());
+		}
+
+		return error;
+	}
+
+	virtual void Clear() override { m_Joints.clear(); }
+
+private:
+	static const PxU32 NB_PULLEYS = 8;
+
+	std::vector<PulleyJoint*> m_Joints;
+};
+
+void InitPhysics()
+{
+	gFoundation = PxCreateFoundation(PX_PHYSICS_VERSION, gAllocator, gErrorCallback);
+	gPhysics = PxCreatePhysics(PX_PHYSICS_VERSION, *gFoundation, PxTolerancesScale(), true);
+
+	PxU32 numCores = SnippetUtils::getNbPhysicalCores();
+	gDispatcher = PxDefaultCpuDispatcherCreate(numCores == 0 ? 0 : numCores - 1);
+
+	gMaterial = gPhysics->createMaterial(0.5f, 0.5f, 0.1f);
+}
+
+void CleanupPhysics()
+{
+	PX_RELEASE(gDispatcher);
+	PX_RELEASE(gPhysics);
+	PX_RELEASE(gFoundation);
+
+	printf("SnippetSolverTuning done.\n");
+}
+
+void PrintResult(const SolverTuningResult& result, PxReal tolerance)
+{
+	const SolverSettings& s = result.settings;
+	printf("%-4s %-8s %6u %6u %10.3f %12.4f %12.4f %s\n", SolverTuner::GetSolverTypeName(s.solverType), SolverTuner::GetFrictionTypeName(s.frictionType),
+		s.positionIterations, s.velocityIterations, result.stepMs, result.maxError, result.avgError, result.maxError <= tolerance ? "ok" : "");
+}
+
+int SnippetMain(int, const char* const*)
+{
+	InitPhysics();
+
+	ChainScenario chain;
+	StackScenario stack;
+	PulleyScenario pulley;
+	SolverTuningScenario* scenarios[] = { &chain, &stack, &pulley };
+
+	SolverTuner tuner(*gPhysics, *gDispatcher, *gMaterial);
+
+	std::vector<SolverTuningResult> best;
+
+	for (SolverTuningScenario* scenario : scenarios)
+	{
+		std::vector<SolverTuningResult> results;
+		tuner.Run(*scenario, results);
+
+		const PxReal tolerance = scenario->GetTolerance();
+
+		printf("\n%s, %s tolerance %.3f\n", scenario->GetName(), scenario->GetErrorName(), tolerance);
+		printf("%-4s %-8s %6s %6s %10s %12s %12s\n", "type", "friction", "pos", "vel", "ms", "max error", "avg error");
+
+#if PRINT_ALL_RESULTS
+		for (const SolverTuningResult& result : results)
+			PrintResult(result, tolerance);
+#else
+		// ֹ /   ġ ϴ   . Run      ޾ δ.
+		for (size_t begin = 0; begin < results.size();)
+		{
+			size_t end = begin;
+			while (end < results.size() && results[end].settings.solverType == results[begin].settings.solverType && results[end].settings.frictionType == results[begin].settings.frictionType)
+				end++;
+
+			const std::vector<SolverTuningResult> group(results.begin() + begin, results.begin() + end);
+			const PxU32 index = SolverTuner::FindCheapest(group, tolerance);
+
+			if (index != PX_MAX_U32)
+				PrintResult(group[index], tolerance);
+			else
+				printf("%-4s %-8s %6s %6s %10s %12s %12s\n", SolverTuner::GetSolverTypeName(group[0].settings.solverType), SolverTuner::GetFrictionTypeName(group[0].settings.frictionType), "-", "-", "-", "-", "-");
+
+			begin = end;
+		}
+#endif
+
+		const PxU32 index = SolverTuner::FindCheapest(results, tolerance);
+		best.push_back(index != PX_MAX_U32 ? results[index] : SolverTuningResult{ { PxSolverType::ePGS, PxFrictionType::ePATCH, 0, 0 }, 0.0f, PX_MAX_F32, PX_MAX_F32 });
+	}
+
+	printf("\nrecommended settings\n");
+	printf("%-8s %-4s %-8s %6s %6s %10s %12s\n", "class", "type", "friction", "pos", "vel", "ms", "max error");
+
+	for (PxU32 i = 0; i < PxU32(best.size()); i++)
+	{
+		const SolverSettings& s = best[i].settings;
+
+		if (s.positionIterations)
+			printf("%-8s %-4s %-8s %6u %6u %10.3f %12.4f\n", scenarios[i]->GetName(), SolverTuner::GetSolverTypeName(s.solverType), SolverTuner::GetFrictionTypeName(s.frictionType),
+				s.positionIterations, s.velocityIterations, best[i].stepMs, best[i].maxError);
+		else
+			printf("%-8s none within tolerance\n", scenarios[i]->GetName());
+	}
+
+	CleanupPhysics();
+
+	return 0;
+}